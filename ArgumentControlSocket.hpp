@@ -0,0 +1,360 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+// Standard includes
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+// System includes
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Local includes
+#include "ArgumentParser.hpp"
+
+/*
+ * Notes:
+ *   - Only available on POSIX systems
+ *   - Link with -pthread where required
+ */
+
+/**
+ * This class is responsible for listening on a Unix domain socket for argument lists,
+ * and applying them to an ArgumentParser with {@see ArgumentParser::parseRuntimeArguments()}.
+ * Each connection sends a single argument list, each argument terminated by a null character,
+ * then closes its write side. The reply is "OK" followed by a line per changed option key,
+ * or "ERROR: " followed by the reason the update was rejected. A connection that has not sent its argument list
+ * within CONNECTION_TIMEOUT_MILLISECONDS is answered with an error and closed, so it cannot stall the listener.
+ * Only the user owning the process may connect, the socket is created with mode 0600.
+ * While listening, the ArgumentParser is to be changed only through this socket,
+ * and read through {@see ArgumentParser::getParseResult()}.
+ */
+class ArgumentControlSocket
+{
+private:
+
+	static const size_t MAX_MESSAGE_LENGTH = 1 << 20;
+	static const int CONNECTION_TIMEOUT_MILLISECONDS = 5000;
+
+	ArgumentParser& mParser;
+	std::string mSocketPath;
+	int mListenDescriptor;
+	int mWakeDescriptors[ 2 ];
+	std::atomic< bool > mRunning;
+	std::thread mThread;
+
+	// Set the close-on-exec flag, where it could not be set atomically on creation
+	static void _setCloseOnExec(
+		int descriptor )
+	{
+		fcntl( descriptor, F_SETFD, fcntl( descriptor, F_GETFD ) | FD_CLOEXEC );
+	}
+
+	// The deadline of a connection starting now
+	static std::chrono::steady_clock::time_point _connectionDeadline()
+	{
+		return std::chrono::steady_clock::now() + std::chrono::milliseconds( static_cast< int64_t >( CONNECTION_TIMEOUT_MILLISECONDS ) );
+	}
+
+	// Milliseconds left until the deadline, 0 once it has passed
+	static int _remainingMilliseconds(
+		std::chrono::steady_clock::time_point deadline )
+	{
+		auto remaining = std::chrono::duration_cast< std::chrono::milliseconds >( deadline - std::chrono::steady_clock::now() );
+		return ( 0 < remaining.count() ) ? static_cast< int >( remaining.count() ) : 0;
+	}
+
+	// Read the argument list from the connection, apply it, and reply.
+	// The connection is polled together with the wake pipe, so stopping is never held up by a client.
+	// The whole argument list must arrive before a single deadline, however slowly a client trickles it in.
+	void _handleConnection(
+		int connectionDescriptor )
+	{
+		struct pollfd descriptors[ 2 ] = {
+			{ connectionDescriptor, POLLIN, 0 },
+			{ mWakeDescriptors[ 0 ], POLLIN, 0 } };
+
+		auto deadline = _connectionDeadline();
+
+		// Replies are bounded by the same timeout, should the client not read them
+		struct timeval sendTimeout = { CONNECTION_TIMEOUT_MILLISECONDS / 1000, ( CONNECTION_TIMEOUT_MILLISECONDS % 1000 ) * 1000 };
+		setsockopt( connectionDescriptor, SOL_SOCKET, SO_SNDTIMEO, &sendTimeout, sizeof( sendTimeout ) );
+#ifdef SO_NOSIGPIPE
+		int noSignal = 1;
+		setsockopt( connectionDescriptor, SOL_SOCKET, SO_NOSIGPIPE, &noSignal, sizeof( noSignal ) );
+#endif
+
+		std::string message;
+		std::string reply;
+		char buffer[ 4096 ];
+		ssize_t count;
+
+		while ( reply.empty() )
+		{
+			int ready = poll( descriptors, 2, _remainingMilliseconds( deadline ) );
+
+			if ( ( 0 > ready ) and ( EINTR == errno ) )
+			{
+				continue;
+			}
+			else if ( 0 > ready )
+			{
+				reply = std::string( "ERROR: Unable to read the argument list: " ) + strerror( errno ) + "\n";
+			}
+			else if ( 0 == ready )
+			{
+				reply = "ERROR: Timed out reading the argument list\n";
+			}
+			else if ( 0 != descriptors[ 1 ].revents )
+			{
+				// Stopping, the connection is dropped without a reply
+				close( connectionDescriptor );
+				return;
+			}
+			else if ( 0 < ( count = read( connectionDescriptor, buffer, sizeof( buffer ) ) ) )
+			{
+				message.append( buffer, static_cast< size_t >( count ) );
+
+				if ( MAX_MESSAGE_LENGTH < message.size() )
+				{
+					reply = "ERROR: Argument list too long\n";
+				}
+			}
+			else if ( ( 0 > count ) and ( EINTR != errno ) and ( EAGAIN != errno ) )
+			{
+				reply = std::string( "ERROR: Unable to read the argument list: " ) + strerror( errno ) + "\n";
+			}
+			else if ( 0 == count )
+			{
+				break;
+			}
+		}
+
+		// Apply the argument list once it was read in full
+		if ( reply.empty() )
+		{
+			std::vector< std::string > arguments;
+			for ( size_t begin( 0 ), end; begin < message.size(); begin = end + 1 )
+			{
+				end = message.find( '\0', begin );
+				end = ( std::string::npos == end ) ? message.size() : end;
+				arguments.emplace_back( message, begin, end - begin );
+			}
+
+			try
+			{
+				reply = "OK\n";
+				for ( const auto& changedOption : mParser.parseRuntimeArguments( arguments ) )
+				{
+					reply.append( changedOption + "\n" );
+				}
+			}
+			catch ( const std::exception& exception )
+			{
+				reply = std::string( "ERROR: " ) + exception.what() + "\n";
+			}
+		}
+
+		// A client that has gone away must not raise SIGPIPE
+#ifdef MSG_NOSIGNAL
+		const int sendFlags = MSG_NOSIGNAL;
+#else
+		const int sendFlags = 0;
+#endif
+
+		auto replyDeadline = _connectionDeadline();
+
+		for ( size_t offset( 0 ); offset < reply.size(); offset += static_cast< size_t >( count ) )
+		{
+			count = send( connectionDescriptor, reply.data() + offset, reply.size() - offset, sendFlags );
+
+			if ( ( 0 >= count ) or ( 0 == _remainingMilliseconds( replyDeadline ) ) )
+			{
+				break;
+			}
+		}
+
+		close( connectionDescriptor );
+	}
+
+	// Accept connections until stopped
+	void _listen()
+	{
+		struct pollfd descriptors[ 2 ] = {
+			{ mListenDescriptor, POLLIN, 0 },
+			{ mWakeDescriptors[ 0 ], POLLIN, 0 } };
+
+		while ( mRunning.load() )
+		{
+			if ( 0 > poll( descriptors, 2, -1 ) )
+			{
+				if ( EINTR == errno )
+				{
+					continue;
+				}
+
+				break;
+			}
+
+			if ( 0 != descriptors[ 1 ].revents )
+			{
+				break;
+			}
+
+			if ( 0 != ( descriptors[ 0 ].revents & POLLIN ) )
+			{
+#ifdef __linux__
+				int connectionDescriptor = accept4( mListenDescriptor, nullptr, nullptr, SOCK_CLOEXEC );
+#else
+				int connectionDescriptor = accept( mListenDescriptor, nullptr, nullptr );
+#endif
+
+				if ( 0 <= connectionDescriptor )
+				{
+#ifndef __linux__
+					_setCloseOnExec( connectionDescriptor );
+#endif
+					_handleConnection( connectionDescriptor );
+				}
+			}
+		}
+	}
+
+public:
+
+	/**
+	 * Create the Unix domain socket at {@param socketPath} and start listening on a background thread.
+	 * Any stale socket at the path is removed first; any other file at the path is left in place, and binding fails.
+	 * The socket is made accessible only to the user owning the process before it accepts connections,
+	 * regardless of the umask. The descriptors are not inherited by child processes.
+	 * @param parser Reference to the ArgumentParser to apply the argument lists to. It must outlive this instance.
+	 * @param socketPath The file system path of the socket.
+	 * @throw std::invalid_argument is thrown if {@param socketPath} is too long for a socket address.
+	 * @throw std::system_error is thrown if the socket could not be created, bound, restricted to its owner, or listened on.
+	 */
+	ArgumentControlSocket(
+		ArgumentParser& parser,
+		const std::string& socketPath ) :
+		mParser( parser ),
+		mSocketPath( socketPath ),
+		mListenDescriptor( -1 ),
+		mRunning( false )
+	{
+		struct sockaddr_un address;
+		memset( &address, 0, sizeof( address ) );
+		address.sun_family = AF_UNIX;
+
+		if ( sizeof( address.sun_path ) <= socketPath.size() )
+		{
+			throw std::invalid_argument( "The socket path is too long: " + socketPath );
+		}
+
+		memcpy( address.sun_path, socketPath.c_str(), socketPath.size() + 1 );
+
+#ifdef __linux__
+		if ( 0 != pipe2( mWakeDescriptors, O_CLOEXEC ) )
+#else
+		if ( 0 != pipe( mWakeDescriptors ) )
+#endif
+		{
+			throw std::system_error( errno, std::generic_category(), "Unable to create the wake pipe" );
+		}
+
+#ifdef SOCK_CLOEXEC
+		mListenDescriptor = socket( AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0 );
+#else
+		mListenDescriptor = socket( AF_UNIX, SOCK_STREAM, 0 );
+#endif
+#ifndef __linux__
+		_setCloseOnExec( mWakeDescriptors[ 0 ] );
+		_setCloseOnExec( mWakeDescriptors[ 1 ] );
+#endif
+#ifndef SOCK_CLOEXEC
+		if ( 0 <= mListenDescriptor )
+		{
+			_setCloseOnExec( mListenDescriptor );
+		}
+#endif
+
+		// Only a stale socket is removed, never any other kind of file
+		struct stat pathStatus;
+		if ( ( 0 == lstat( socketPath.c_str(), &pathStatus ) ) and S_ISSOCK( pathStatus.st_mode ) )
+		{
+			unlink( socketPath.c_str() );
+		}
+
+		// Connections are refused until listening, so the socket is restricted to its owner in between
+		bool bound = ( 0 <= mListenDescriptor )
+			and ( 0 == bind( mListenDescriptor, reinterpret_cast< struct sockaddr* >( &address ), sizeof( address ) ) );
+
+		if ( not bound
+			or ( 0 != chmod( socketPath.c_str(), S_IRUSR | S_IWUSR ) )
+			or ( 0 != listen( mListenDescriptor, 8 ) ) )
+		{
+			int error = errno;
+
+			if ( bound )
+			{
+				unlink( socketPath.c_str() );
+			}
+
+			if ( 0 <= mListenDescriptor )
+			{
+				close( mListenDescriptor );
+			}
+
+			close( mWakeDescriptors[ 0 ] );
+			close( mWakeDescriptors[ 1 ] );
+			throw std::system_error( error, std::generic_category(), "Unable to listen on socket: " + socketPath );
+		}
+
+		mRunning.store( true );
+		mThread = std::thread( &ArgumentControlSocket::_listen, this );
+	}
+
+	ArgumentControlSocket(
+		const ArgumentControlSocket& other ) = delete;
+
+	ArgumentControlSocket& operator=(
+		const ArgumentControlSocket& other ) = delete;
+
+	/**
+	 * Destructor. Stops listening, then closes and removes the socket.
+	 */
+	~ArgumentControlSocket()
+	{
+		// Closing the write side of the pipe wakes the listening thread
+		mRunning.store( false );
+		close( mWakeDescriptors[ 1 ] );
+		mThread.join();
+
+		close( mWakeDescriptors[ 0 ] );
+		close( mListenDescriptor );
+		unlink( mSocketPath.c_str() );
+	}
+
+	/**
+	 * The file system path of the socket.
+	 * @return Const reference to the socket path.
+	 */
+	const std::string& socketPath() const
+	{
+		return mSocketPath;
+	}
+};
@@ -7,29 +7,186 @@
 
 // Standard includes
 #include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <functional>
+#include <iterator>
+#include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+// System includes
+#include <sys/stat.h>
+
 // Conditional includes
 #ifdef _WIN32
+#include <io.h>
 #define strcasecmp _stricmp
 #else
+#include <fcntl.h>
 #include <strings.h>
+#include <unistd.h>
+extern char** environ;
 #endif
 
 /*
  * Notes:
  *   - Required at a minimum C++14
+ *   - Path validation uses std::thread, link with -pthread where required
+ */
+
+/**
+ * This template is responsible for converting option values from their string form.
+ * Specialize it for a type to have values of that type converted differently.
+ * The general case reads the value with operator>>, which must consume the entire value.
+ */
+template < typename Type, typename Enable = void >
+struct ArgumentValueTraits
+{
+	/**
+	 * Convert the string value to {@tparam Type}.
+	 * @param value The string value to convert.
+	 * @return The converted value.
+	 * @throw std::invalid_argument is thrown if the value cannot be converted.
+	 */
+	static Type convert(
+		const std::string& value )
+	{
+		std::istringstream stream( value );
+		Type result;
+
+		if ( not ( stream >> result ) or not ( stream >> std::ws ).eof() )
+		{
+			throw std::invalid_argument( "Unable to convert the value: " + value );
+		}
+
+		return result;
+	}
+};
+
+/**
+ * Strings are taken as is.
+ */
+template <>
+struct ArgumentValueTraits< std::string >
+{
+	static std::string convert(
+		const std::string& value )
+	{
+		return value;
+	}
+};
+
+/**
+ * Booleans accept true/false, yes/no, on/off, and 1/0, ignoring case.
+ * The empty string is true, so that option flags taking no value set a bound boolean.
+ */
+template <>
+struct ArgumentValueTraits< bool >
+{
+	static bool convert(
+		const std::string& value )
+	{
+		static const char* const TRUE_VALUES[] = { "", "true", "yes", "on", "1" };
+		static const char* const FALSE_VALUES[] = { "false", "no", "off", "0" };
+
+		for ( const char* trueValue : TRUE_VALUES )
+		{
+			if ( 0 == strcasecmp( trueValue, value.c_str() ) )
+			{
+				return true;
+			}
+		}
+
+		for ( const char* falseValue : FALSE_VALUES )
+		{
+			if ( 0 == strcasecmp( falseValue, value.c_str() ) )
+			{
+				return false;
+			}
+		}
+
+		throw std::invalid_argument( "Unable to convert the value to a boolean: " + value );
+	}
+};
+
+/**
+ * Integers are converted with strtoll() or strtoull(), accepting decimal, octal, and hexadecimal,
+ * and must be within the range of the integer type.
+ */
+template < typename Type >
+struct ArgumentValueTraits< Type, typename std::enable_if< std::is_integral< Type >::value
+	and not std::is_same< Type, bool >::value >::type >
+{
+	static Type convert(
+		const std::string& value )
+	{
+		const char* begin = value.c_str();
+		char* end = nullptr;
+		bool inRange;
+		Type result;
+
+		errno = 0;
+		if ( std::is_signed< Type >::value )
+		{
+			long long converted = strtoll( begin, &end, 0 );
+			inRange = ( std::numeric_limits< Type >::min() <= converted ) and ( converted <= std::numeric_limits< Type >::max() );
+			result = static_cast< Type >( converted );
+		}
+		else
+		{
+			unsigned long long converted = strtoull( begin, &end, 0 );
+			inRange = ( nullptr == strchr( begin, '-' ) ) and ( converted <= std::numeric_limits< Type >::max() );
+			result = static_cast< Type >( converted );
+		}
+
+		if ( value.empty() or ( '\0' != *end ) or ( 0 != errno ) or not inRange )
+		{
+			throw std::invalid_argument( "Unable to convert the value to an integer: " + value );
+		}
+
+		return result;
+	}
+};
+
+/**
+ * Floating point values are converted with strtold().
  */
+template < typename Type >
+struct ArgumentValueTraits< Type, typename std::enable_if< std::is_floating_point< Type >::value >::type >
+{
+	static Type convert(
+		const std::string& value )
+	{
+		char* end = nullptr;
+
+		errno = 0;
+		long double converted = strtold( value.c_str(), &end );
+
+		if ( value.empty() or ( '\0' != *end ) or ( ERANGE == errno ) )
+		{
+			throw std::invalid_argument( "Unable to convert the value to a floating point number: " + value );
+		}
+
+		return static_cast< Type >( converted );
+	}
+};
 
 /**
  * This class is responsible for holding the values
@@ -40,10 +197,162 @@ class OptionArgument
 private:
 
 	friend class ArgumentParser;
+	friend class ParseResult;
+
+public:
+
+	/**
+	 * Information about a path value, cached by the path validation
+	 * stage of {@see ArgumentParser::parseArguments()}.
+	 */
+	struct PathInformation
+	{
+		bool directory;  ///< The path names a directory.
+		uint64_t size;   ///< The size, in bytes, of the file at the path.
+	};
+
+	/**
+	 * A view of the values given together by one occurrence of an option flag taking a number of values,
+	 * see {@see ArgumentParser::setOptionValueCount()}. The view refers into the values of the option argument,
+	 * and is valid as long as the option argument is not changed.
+	 */
+	class ValueGroup
+	{
+	private:
+
+		const std::string* mBegin;
+		const std::string* mEnd;
+
+	public:
+
+		ValueGroup(
+			const std::string* begin,
+			const std::string* end ) :
+			mBegin( begin ),
+			mEnd( end )
+		{
+		}
+
+		const std::string* begin() const
+		{
+			return mBegin;
+		}
+
+		const std::string* end() const
+		{
+			return mEnd;
+		}
+
+		bool empty() const
+		{
+			return mBegin == mEnd;
+		}
+
+		size_t size() const
+		{
+			return static_cast< size_t >( mEnd - mBegin );
+		}
+
+		const std::string& operator[](
+			size_t index ) const
+		{
+			return mBegin[ index ];
+		}
+	};
+
+private:
 
 	std::string mOptionString;
 	std::string mValueName;
 	std::vector< std::string > mOptionValues;
+	std::vector< PathInformation > mPathInformation;
+	size_t mCount = 0;
+	bool mNegated = false;
+	uint64_t mFlags = 0;
+	std::vector< size_t > mGroupOffsets;
+
+	// Digest of the values handed to the callback of an option that streams its values, in order; 0 if none were
+	uint64_t mStreamDigest = 0;
+
+	// Fold a streamed value into the stream digest, with FNV-1a over its bytes and a terminating null character
+	void _foldStreamValue(
+		const std::string& value )
+	{
+		uint64_t digest = ( 0 == mStreamDigest ) ? 0xcbf29ce484222325ULL : mStreamDigest;
+
+		for ( const char* character = value.c_str(), *end = character + value.size() + 1; end != character; ++character )
+		{
+			digest = ( digest ^ static_cast< unsigned char >( *character ) ) * 0x100000001b3ULL;
+		}
+
+		mStreamDigest = digest;
+	}
+
+	// Converted values cached by get(), tagged with the type they were converted to, and linked to those of other types
+	class _ConvertedValues
+	{
+	public:
+
+		const void* type;
+		const _ConvertedValues* next = nullptr;
+
+		_ConvertedValues(
+			const void* convertedType ) :
+			type( convertedType )
+		{
+		}
+
+		virtual ~_ConvertedValues()
+		{
+		}
+	};
+
+	template < typename Type >
+	class _TypedConvertedValues : public _ConvertedValues
+	{
+	public:
+
+		std::vector< Type > values;
+
+		_TypedConvertedValues() :
+			_ConvertedValues( _typeTag< Type >() )
+		{
+		}
+	};
+
+	// A unique address per type, to tag the converted values with
+	template < typename Type >
+	static const void* _typeTag()
+	{
+		static const char tag = 0;
+		return &tag;
+	}
+
+	// Find the converted values of a type, from the head of the converted values
+	static const _ConvertedValues* _findConvertedValues(
+		const _ConvertedValues* converted,
+		const void* type )
+	{
+		for ( ; ( nullptr != converted ) and ( type != converted->type ); converted = converted->next );
+		return converted;
+	}
+
+	// The converted values of each type read, pushed by get() without a lock, as snapshots share their option arguments
+	// across threads. Entries are never removed while shared, only freed once the values change or the option argument goes.
+	mutable std::atomic< const _ConvertedValues* > mConvertedValues{ nullptr };
+
+	// Free the converted values, which must not be shared across threads at the time
+	void _clearConvertedValues()
+	{
+		const _ConvertedValues* converted = mConvertedValues.exchange( nullptr );
+
+		while ( nullptr != converted )
+		{
+			const _ConvertedValues* next = converted->next;
+			delete converted;
+			converted = next;
+		}
+	}
 
 	// move assign
 	void _moveAssign(
@@ -52,6 +361,14 @@ private:
 		mOptionString = std::move( other.mOptionString );
 		mValueName = std::move( other.mValueName );
 		mOptionValues = std::move( other.mOptionValues );
+		mPathInformation = std::move( other.mPathInformation );
+		mCount = std::exchange( other.mCount, 0 );
+		mNegated = other.mNegated;
+		mFlags = std::exchange( other.mFlags, 0 );
+		mGroupOffsets = std::move( other.mGroupOffsets );
+		mStreamDigest = std::exchange( other.mStreamDigest, 0 );
+		_clearConvertedValues();
+		mConvertedValues.store( other.mConvertedValues.exchange( nullptr ) );
 	}
 
 	// copy assign
@@ -61,6 +378,15 @@ private:
 		mOptionString = other.mOptionString;
 		mValueName = other.mValueName;
 		mOptionValues = other.mOptionValues;
+		mPathInformation = other.mPathInformation;
+		mCount = other.mCount;
+		mNegated = other.mNegated;
+		mFlags = other.mFlags;
+		mGroupOffsets = other.mGroupOffsets;
+		mStreamDigest = other.mStreamDigest;
+
+		// The copy converts its values again on its first access
+		_clearConvertedValues();
 	}
 
 	// assignment constructor; this'll be called by ArgumentParser
@@ -83,6 +409,14 @@ public:
 	{
 	}
 
+	/**
+	 * Destructor, freeing the converted values.
+	 */
+	~OptionArgument()
+	{
+		_clearConvertedValues();
+	}
+
 	/**
 	 * Move constructor.
 	 * @param other R-Value to OptionArgument to move to this instance.
@@ -135,6 +469,38 @@ public:
 		return *this;
 	}
 
+	/**
+	 * The number of times the option flag was present, across all sources.
+	 * Unlike {@see size()}, this counts every occurrence regardless of the option selection,
+	 * so a repeated option flag that takes no value, such as --verbose --verbose, has a count of 2.
+	 * @return The number of occurrences of the option flag.
+	 */
+	size_t count() const
+	{
+		return mCount;
+	}
+
+	/**
+	 * The bitmask of a flag-set option, see {@see ArgumentParser::setFlagSetVocabulary()}.
+	 * Bit N is set when the Nth name of the vocabulary is set by the values of the option.
+	 * @return The bitmask decoded from the values, 0 for options that are not flag-set options.
+	 */
+	uint64_t flags() const
+	{
+		return mFlags;
+	}
+
+	/**
+	 * The state of a negatable option flag, see OptionValue::negatable. Together with the presence of the option
+	 * in the parsed options map this is a tri-state: not present, present as --foo, or present as --no-foo.
+	 * The last occurrence of the option flag decides the state.
+	 * @return True if the option flag was last given with the "--no-" prefix, false otherwise.
+	 */
+	bool negated() const
+	{
+		return mNegated;
+	}
+
 	/**
 	 * The option flag that this option argument came from.
 	 * @return The string of the option flag.
@@ -144,6 +510,99 @@ public:
 		return mOptionString;
 	}
 
+	/**
+	 * Get the value at {@param index} converted to {@tparam Type}, see {@see ArgumentValueTraits}.
+	 * All values of the option are converted on the first access of a type and cached with this option argument,
+	 * a cache per type read. Repeated reads of a cached type cost an atomic pointer load and a walk over the
+	 * types cached, without locking or reference counting. The cache is not copied with the option argument.
+	 * This method may be called from multiple threads on a shared instance; should two threads convert the same
+	 * type at once, the values of the first are kept and those of the other discarded.
+	 * @param index Index of value to retrieve. [default: 0]
+	 * @return The converted value.
+	 * @throw std::out_of_range is thrown if no value exists at the given index.
+	 * @throw std::invalid_argument is thrown if a value cannot be converted.
+	 */
+	template < typename Type >
+	Type get(
+		size_t index = 0 ) const
+	{
+		const _ConvertedValues* head = mConvertedValues.load();
+		const _ConvertedValues* cached = _findConvertedValues( head, _typeTag< Type >() );
+
+		if ( nullptr == cached )
+		{
+			std::unique_ptr< _TypedConvertedValues< Type > > converted( new _TypedConvertedValues< Type >() );
+			converted->values.reserve( mOptionValues.size() );
+
+			for ( const auto& value : mOptionValues )
+			{
+				converted->values.push_back( ArgumentValueTraits< Type >::convert( value ) );
+			}
+
+			// Push the values, unless another thread has cached the same type in the meantime
+			converted->next = head;
+			while ( not mConvertedValues.compare_exchange_weak( head, converted.get() )
+				and ( nullptr == ( cached = _findConvertedValues( head, _typeTag< Type >() ) ) ) )
+			{
+				converted->next = head;
+			}
+
+			if ( nullptr == cached )
+			{
+				cached = converted.release();
+			}
+		}
+
+		return static_cast< const _TypedConvertedValues< Type >& >( *cached ).values.at( index );
+	}
+
+	/**
+	 * Get the values given together by one occurrence of the option flag, see {@see ArgumentParser::setOptionValueCount()}.
+	 * For options that take a single value, each value is a group of its own.
+	 * @param index Index of the group to retrieve. [default: 0]
+	 * @return A view of the values of the group.
+	 * @throw std::out_of_range is thrown if no group exists at the given index.
+	 */
+	ValueGroup group(
+		size_t index = 0 ) const
+	{
+		if ( groupCount() <= index )
+		{
+			throw std::out_of_range( "No value group exists at the given index" );
+		}
+
+		if ( mGroupOffsets.empty() )
+		{
+			return ValueGroup( mOptionValues.data() + index, mOptionValues.data() + index + 1 );
+		}
+
+		size_t end = ( ( index + 1 ) < mGroupOffsets.size() ) ? mGroupOffsets[ index + 1 ] : mOptionValues.size();
+		return ValueGroup( mOptionValues.data() + mGroupOffsets[ index ], mOptionValues.data() + end );
+	}
+
+	/**
+	 * The number of value groups present for this option, see {@see group()}.
+	 * @return The number of value groups.
+	 */
+	size_t groupCount() const
+	{
+		return mGroupOffsets.empty() ? mOptionValues.size() : mGroupOffsets.size();
+	}
+
+	/**
+	 * Get the cached path information for the value at {@param index}.
+	 * The information is only present for options with path validation enabled,
+	 * see {@see ArgumentParser::setPathValidation()}.
+	 * @param index Index of the value to retrieve the path information of. [default: 0]
+	 * @return Const reference to the path information of the value.
+	 * @throw std::out_of_range is thrown if no path information exists at the given index.
+	 */
+	const PathInformation& pathInformation(
+		size_t index = 0 ) const
+	{
+		return mPathInformation.at( index );
+	}
+
 	/**
 	 * The number of values present for this option.
 	 * If the option has been set to take only the first or the
@@ -180,168 +639,2795 @@ public:
 };
 
 /**
- * This class is responsible for building a command line argument parser
- * and being called upon to parse and handle command line arguments.
+ * This class is an immutable snapshot of the result of parsing the arguments.
+ * Snapshots are shared by reference count, so they remain valid for as long as
+ * they are held, regardless of the ArgumentParser being cleared or parsing again.
  */
-class ArgumentParser
+class ParseResult
 {
 public:
 
 	/**
-	 * This enumeration flags whether or not a value
-	 * is required, optional, or not expected for a given option flag.
+	 * A difference in an option between two parse results, see {@see ParseResult::diff()}.
 	 */
-	enum class OptionValue : int
+	struct Difference
 	{
-		none,      ///< No value is expected for the option flag.
-		optional,  ///< Any value present is optional for the option flag.
-		required   ///< A value is required for the option flag.
+		/**
+		 * This enumeration flags how the option differs.
+		 */
+		enum class Kind : int
+		{
+			added,    ///< The option is only present in the current parse result.
+			removed,  ///< The option is only present in the previous parse result.
+			changed   ///< The option is present in both, with different values, or the same values grouped differently.
+		};
+
+		std::string key;                     ///< The key of the option, the valueName or option flag.
+		Kind kind;                           ///< How the option differs.
+		size_t previousSize;                 ///< The number of values in the previous parse result.
+		size_t currentSize;                  ///< The number of values in the current parse result.
+		std::vector< size_t > changedValues; ///< The indices, present in both, of the values that differ.
 	};
 
 	/**
-	 * This enumeration flags which value to take
-	 * should an option flag be present more than once.
+	 * A 128 bit fingerprint of a parse result, see {@see ParseResult::fingerprint()}.
 	 */
-	enum class OptionSelection : int
+	struct Fingerprint
 	{
-		take_first,  ///< Take only the first value for the option flag.
-		take_last,   ///< Take only the last value for the option flag.
-		take_all     ///< Take all values for the option flag.
+		uint64_t high;  ///< The high 64 bits of the fingerprint.
+		uint64_t low;   ///< The low 64 bits of the fingerprint.
+
+		bool operator==(
+			const Fingerprint& other ) const
+		{
+			return ( high == other.high ) and ( low == other.low );
+		}
+
+		bool operator!=(
+			const Fingerprint& other ) const
+		{
+			return not ( *this == other );
+		}
+
+		bool operator<(
+			const Fingerprint& other ) const
+		{
+			return ( high < other.high ) or ( ( high == other.high ) and ( low < other.low ) );
+		}
 	};
 
 private:
 
-	class _OptionHandler
+	friend class ArgumentParser;
+
+	// Incremental 128 bit hash over a byte stream, mixing 8 bytes at a time into two lanes
+	class _Hasher
 	{
-	public:
+	private:
 
-		std::string defaultStringValue;
-		std::string valueName;
-		std::function< void( const std::string& ) > callback;
-		ArgumentParser::OptionValue valueRequired;
-		ArgumentParser::OptionSelection selection;
-		std::string helpString;
-		bool requiredOption;
+		uint64_t mHigh = 0x9e3779b97f4a7c15ULL;
+		uint64_t mLow = 0xc2b2ae3d27d4eb4fULL;
+		uint64_t mPending = 0;
+		size_t mPendingLength = 0;
+		uint64_t mLength = 0;
 
-	private:
+		static uint64_t _rotate(
+			uint64_t value,
+			int shift )
+		{
+			return ( value << shift ) | ( value >> ( 64 - shift ) );
+		}
 
-		// move assignment
-		void _moveAssign(
-			_OptionHandler&& other )
+		static uint64_t _finalize(
+			uint64_t value )
 		{
-			this->defaultStringValue = std::move( other.defaultStringValue );
-			this->valueName = std::move( other.valueName );
-			this->callback = std::exchange( other.callback, nullptr );
-			this->valueRequired = std::exchange( other.valueRequired, ArgumentParser::OptionValue::optional );
-			this->selection = std::exchange( other.selection, ArgumentParser::OptionSelection::take_last );
-			this->helpString = std::move( other.helpString );
-			this->requiredOption = std::exchange( other.requiredOption, false );
+			value ^= value >> 33;
+			value *= 0xff51afd7ed558ccdULL;
+			value ^= value >> 33;
+			value *= 0xc4ceb9fe1a85ec53ULL;
+			value ^= value >> 33;
+			return value;
 		}
 
-		// copy assignment
-		void _copyAssign(
-			const _OptionHandler& other )
+		void _mix(
+			uint64_t word )
 		{
-			this->defaultStringValue = other.defaultStringValue;
-			this->valueName = other.valueName;
-			this->callback = other.callback;
-			this->valueRequired = other.valueRequired;
-			this->selection = other.selection;
-			this->helpString = other.helpString;
-			this->requiredOption = other.requiredOption;
+			mHigh ^= _rotate( word * 0x87c37b91114253d5ULL, 31 ) * 0x4cf5ad432745937fULL;
+			mHigh = _rotate( mHigh, 27 ) + mLow;
+			mHigh = mHigh * 5 + 0x52dce729;
+			mLow ^= _rotate( word * 0x4cf5ad432745937fULL, 33 ) * 0x87c37b91114253d5ULL;
+			mLow = _rotate( mLow, 31 ) + mHigh;
+			mLow = mLow * 5 + 0x38495ab5;
 		}
 
 	public:
 
-		// default constructor
-		_OptionHandler()
+		void update(
+			const char* data,
+			size_t length )
 		{
-			this->defaultStringValue = std::string( "" );
-			this->valueName = std::string( "" );
-			this->callback = nullptr;
-			this->valueRequired = ArgumentParser::OptionValue::optional;
-			this->selection = ArgumentParser::OptionSelection::take_last;
-			this->helpString = std::string( "" );
-			this->requiredOption = false;
+			mLength += length;
+
+			// Fill the pending word first
+			for ( ; ( 0 < length ) and ( 0 != mPendingLength ); --length, ++data )
+			{
+				mPending |= static_cast< uint64_t >( static_cast< unsigned char >( *data ) ) << ( 8 * mPendingLength );
+				if ( 8 == ++mPendingLength )
+				{
+					_mix( mPending );
+					mPending = 0;
+					mPendingLength = 0;
+				}
+			}
+
+			// Then whole words straight from the data
+			for ( uint64_t word; 8 <= length; length -= 8, data += 8 )
+			{
+				memcpy( &word, data, sizeof( word ) );
+				_mix( word );
+			}
+
+			for ( ; 0 < length; --length, ++data )
+			{
+				mPending |= static_cast< uint64_t >( static_cast< unsigned char >( *data ) ) << ( 8 * mPendingLength++ );
+			}
 		}
 
-		// move constructor
-		_OptionHandler(
-			_OptionHandler&& other )
+		Fingerprint finish()
 		{
-			_moveAssign( std::move( other ) );
+			uint64_t high = mHigh;
+			uint64_t low = mLow ^ mLength;
+
+			if ( 0 != mPendingLength )
+			{
+				high ^= _rotate( mPending * 0x87c37b91114253d5ULL, 31 ) * 0x4cf5ad432745937fULL;
+			}
+
+			high += low;
+			low += high;
+			high = _finalize( high );
+			low = _finalize( low );
+			high += low;
+			low += high;
+			return { high, low };
 		}
+	};
 
-		// copy constructor
-		_OptionHandler(
-			const _OptionHandler& other )
+	// Walk two parsed options maps in a single merge pass over their ordered keys, visiting each key
+	// with its option argument from either map, or null where the key is absent from that map
+	template < typename Visitor >
+	static void _mergeOptions(
+		const std::map< std::string, OptionArgument >& previousOptions,
+		const std::map< std::string, OptionArgument >& currentOptions,
+		Visitor visitor )
+	{
+		auto previousIterator = previousOptions.begin();
+		auto currentIterator = currentOptions.begin();
+
+		while ( ( previousOptions.end() != previousIterator ) or ( currentOptions.end() != currentIterator ) )
+		{
+			int order = ( currentOptions.end() == currentIterator ) ? -1
+				: ( previousOptions.end() == previousIterator ) ? 1
+				: previousIterator->first.compare( currentIterator->first );
+
+			if ( 0 > order )
+			{
+				visitor( previousIterator->first, &previousIterator->second, nullptr );
+				++previousIterator;
+			}
+			else if ( 0 < order )
+			{
+				visitor( currentIterator->first, nullptr, &currentIterator->second );
+				++currentIterator;
+			}
+			else
+			{
+				visitor( currentIterator->first, &previousIterator->second, &currentIterator->second );
+				++previousIterator;
+				++currentIterator;
+			}
+		}
+	}
+
+	// Append a JSON string to the buffer, escaping as needed. Runs of characters that need no escaping
+	// are found 8 bytes at a time, testing each byte of a word for a control character, '"', or '\\'.
+	static void _appendJsonString(
+		std::string& buffer,
+		const std::string& value )
+	{
+		static const uint64_t ONES = 0x0101010101010101ULL;
+		static const uint64_t HIGHS = 0x8080808080808080ULL;
+		static const char* HEXADECIMAL = "0123456789abcdef";
+
+		const char* data = value.data();
+		size_t length = value.size();
+		size_t runBegin = 0;
+		size_t index = 0;
+
+		buffer.push_back( '"' );
+
+		while ( index < length )
+		{
+			// Skip whole words that need no escaping
+			for ( uint64_t word; ( index + 8 ) <= length; index += 8 )
+			{
+				memcpy( &word, data + index, sizeof( word ) );
+				uint64_t quotes = word ^ ( ONES * '"' );
+				uint64_t backslashes = word ^ ( ONES * '\\' );
+				uint64_t special = ( ( word - ONES * 0x20 ) & ~word )
+					| ( ( quotes - ONES ) & ~quotes )
+					| ( ( backslashes - ONES ) & ~backslashes );
+
+				if ( 0 != ( special & HIGHS ) )
+				{
+					break;
+				}
+			}
+
+			size_t wordEnd = std::min( length, index + 8 );
+			for ( ; index < wordEnd; ++index )
+			{
+				unsigned char character = static_cast< unsigned char >( data[ index ] );
+
+				if ( ( 0x20 <= character ) and ( '"' != character ) and ( '\\' != character ) )
+				{
+					continue;
+				}
+
+				buffer.append( data + runBegin, index - runBegin );
+				runBegin = index + 1;
+
+				switch ( character )
+				{
+				case '"': buffer.append( "\\\"" ); break;
+				case '\\': buffer.append( "\\\\" ); break;
+				case '\b': buffer.append( "\\b" ); break;
+				case '\f': buffer.append( "\\f" ); break;
+				case '\n': buffer.append( "\\n" ); break;
+				case '\r': buffer.append( "\\r" ); break;
+				case '\t': buffer.append( "\\t" ); break;
+				default:
+					buffer.append( "\\u00" );
+					buffer.push_back( HEXADECIMAL[ character >> 4 ] );
+					buffer.push_back( HEXADECIMAL[ character & 0xF ] );
+					break;
+				}
+			}
+		}
+
+		buffer.append( data + runBegin, length - runBegin );
+		buffer.push_back( '"' );
+	}
+
+	// Walk the tokens of the canonical form, in order
+	template < typename Visitor >
+	void _visitCanonicalArguments(
+		Visitor visitor ) const
+	{
+		// The non-option arguments lead, so that none of them is taken as a value of an option flag when parsed again
+		for ( const auto& argument : mNonOptionArguments )
+		{
+			visitor( argument );
+		}
+
+		for ( const auto& parsedIter : mParsedOptions )
+		{
+			const OptionArgument& optionArgument = parsedIter.second;
+
+			// Positional arguments, keyed by their name rather than an option flag, are given by the non-option arguments
+			if ( 0 != optionArgument.mOptionString.compare( 0, 2, "--" ) )
+			{
+				continue;
+			}
+
+			if ( optionArgument.mNegated )
+			{
+				visitor( "--no-" + optionArgument.mOptionString.substr( 2 ) );
+			}
+			else
+			{
+				for ( size_t count( optionArgument.mValueName.empty() ? optionArgument.mCount : 0 ); 0 < count; --count )
+				{
+					visitor( optionArgument.mOptionString );
+				}
+			}
+
+			if ( optionArgument.mGroupOffsets.empty() )
+			{
+				for ( const auto& value : optionArgument.mOptionValues )
+				{
+					visitor( optionArgument.mOptionString );
+					visitor( value );
+				}
+			}
+			else
+			{
+				for ( size_t index( 0 ); index < optionArgument.groupCount(); ++index )
+				{
+					visitor( optionArgument.mOptionString );
+					for ( const auto& value : optionArgument.group( index ) )
+					{
+						visitor( value );
+					}
+				}
+			}
+		}
+	}
+
+	std::map< std::string, OptionArgument > mParsedOptions;
+	std::vector< std::string > mNonOptionArguments;
+	std::vector< OptionArgument::PathInformation > mNonOptionPathInformation;
+
+	// assignment constructor; this'll be called by ArgumentParser
+	ParseResult(
+		const std::map< std::string, OptionArgument >& parsedOptions,
+		const std::vector< std::string >& nonOptionArguments,
+		const std::vector< OptionArgument::PathInformation >& nonOptionPathInformation )
+	{
+		mParsedOptions = parsedOptions;
+		mNonOptionArguments = nonOptionArguments;
+		mNonOptionPathInformation = nonOptionPathInformation;
+	}
+
+	// Append a value to the serialized buffer
+	static void _write(
+		std::string& buffer,
+		uint64_t value )
+	{
+		buffer.append( reinterpret_cast< const char* >( &value ), sizeof( value ) );
+	}
+
+	static void _write(
+		std::string& buffer,
+		const std::string& value )
+	{
+		_write( buffer, static_cast< uint64_t >( value.size() ) );
+		buffer.append( value );
+	}
+
+	static void _write(
+		std::string& buffer,
+		const std::vector< OptionArgument::PathInformation >& pathInformation )
+	{
+		_write( buffer, static_cast< uint64_t >( pathInformation.size() ) );
+		for ( const auto& information : pathInformation )
+		{
+			buffer.push_back( information.directory ? 1 : 0 );
+			_write( buffer, information.size );
+		}
+	}
+
+	// Read a value from the serialized buffer, advancing the position
+	static uint64_t _readInteger(
+		const char*& position,
+		const char* end )
+	{
+		uint64_t value;
+
+		if ( static_cast< size_t >( end - position ) < sizeof( value ) )
+		{
+			throw std::invalid_argument( "The serialized parse result is truncated" );
+		}
+
+		memcpy( &value, position, sizeof( value ) );
+		position += sizeof( value );
+		return value;
+	}
+
+	static void _read(
+		const char*& position,
+		const char* end,
+		std::string& value )
+	{
+		uint64_t length = _readInteger( position, end );
+
+		if ( static_cast< uint64_t >( end - position ) < length )
+		{
+			throw std::invalid_argument( "The serialized parse result is truncated" );
+		}
+
+		value.assign( position, static_cast< size_t >( length ) );
+		position += length;
+	}
+
+	static void _read(
+		const char*& position,
+		const char* end,
+		std::vector< OptionArgument::PathInformation >& pathInformation )
+	{
+		uint64_t count = _readInteger( position, end );
+
+		if ( static_cast< uint64_t >( end - position ) / ( 1 + sizeof( uint64_t ) ) < count )
+		{
+			throw std::invalid_argument( "The serialized parse result is truncated" );
+		}
+
+		pathInformation.resize( static_cast< size_t >( count ) );
+		for ( auto& information : pathInformation )
+		{
+			information.directory = 0 != *position++;
+			information.size = _readInteger( position, end );
+		}
+	}
+
+	// Read a count of elements, each of which occupies at least {@param minimumSize} bytes
+	static size_t _readCount(
+		const char*& position,
+		const char* end,
+		size_t minimumSize )
+	{
+		uint64_t count = _readInteger( position, end );
+
+		if ( static_cast< uint64_t >( end - position ) / minimumSize < count )
+		{
+			throw std::invalid_argument( "The serialized parse result is truncated" );
+		}
+
+		return static_cast< size_t >( count );
+	}
+
+	static const char* _magic()
+	{
+		return "APR\x01";
+	}
+
+public:
+
+	/**
+	 * Default constructor to an empty ParseResult instance.
+	 */
+	ParseResult()
+	{
+	}
+
+	/**
+	 * Get the options parsed, see {@see ArgumentParser::getParsedOptions()}.
+	 * @return A const reference to the parsed options map.
+	 */
+	const std::map< std::string, OptionArgument >& getParsedOptions() const
+	{
+		return mParsedOptions;
+	}
+
+	/**
+	 * Get the vector of non-option arguments parsed.
+	 * @return A const reference to the non-option arguments vector.
+	 */
+	const std::vector< std::string >& getNonOptionArguments() const
+	{
+		return mNonOptionArguments;
+	}
+
+	/**
+	 * Get the cached path information of the non-option arguments,
+	 * see {@see ArgumentParser::getNonOptionPathInformation()}.
+	 * @return A const reference to the path information vector, indexed as the non-option arguments vector.
+	 */
+	const std::vector< OptionArgument::PathInformation >& getNonOptionPathInformation() const
+	{
+		return mNonOptionPathInformation;
+	}
+
+	/**
+	 * Reconstruct the canonical command line arguments of this parse result. Equivalent command lines,
+	 * those that differ only in the order of the option flags or in values discarded by the option
+	 * selection, have the same canonical form. The non-option arguments lead, in the order they were given,
+	 * positional arguments among them, see {@see ArgumentParser::addPositionalArgument()}.
+	 * The option flags follow in sorted order, each flag followed by
+	 * a value, once per value, option flags that take no value are repeated by their count, see
+	 * {@see OptionArgument::count()}, negated option flags are given once with their "--no-" prefix,
+	 * and option flags taking a number of values are followed by each group of values.
+	 * Options that stream their values have none retained and are left out, see {@see fingerprint()}.
+	 * @return A single buffer holding each argument terminated by a null character; there is no leading application name.
+	 */
+	std::string canonicalArguments() const
+	{
+		size_t size = 0;
+		_visitCanonicalArguments( [ &size ]( const std::string& argument ) { size += argument.size() + 1; } );
+
+		std::string buffer;
+		buffer.reserve( size );
+		_visitCanonicalArguments( [ &buffer ]( const std::string& argument ) { buffer.append( argument.c_str(), argument.size() + 1 ); } );
+		return buffer;
+	}
+
+	/**
+	 * Compute a 128 bit fingerprint of the canonical command line arguments, see {@see canonicalArguments()},
+	 * without building them. Equivalent command lines have the same fingerprint, making it suitable as a cache key.
+	 * Options that stream their values are left out of the canonical form, so a digest of their values,
+	 * in the order streamed, is added after it for each of them. The fingerprint is not cryptographic.
+	 * @return The fingerprint of the canonical command line arguments and the streamed values.
+	 */
+	Fingerprint fingerprint() const
+	{
+		_Hasher hasher;
+		_visitCanonicalArguments( [ &hasher ]( const std::string& argument ) { hasher.update( argument.c_str(), argument.size() + 1 ); } );
+
+		for ( const auto& parsedIter : mParsedOptions )
+		{
+			if ( 0 != parsedIter.second.mStreamDigest )
+			{
+				hasher.update( parsedIter.first.c_str(), parsedIter.first.size() + 1 );
+				hasher.update( reinterpret_cast< const char* >( &parsedIter.second.mStreamDigest ), sizeof( uint64_t ) );
+			}
+		}
+
+		return hasher.finish();
+	}
+
+	/**
+	 * Compute the differences in the options between two parse results of the same option set.
+	 * The options are walked in a single merge pass over their ordered keys, and the values of
+	 * options present in both are compared element by element. Values beyond the size of the shorter
+	 * list are reported through the sizes, not the changed value indices. Option flags that take no value
+	 * are changed when their count or negation differs, see {@see OptionArgument::count()} and
+	 * {@see OptionArgument::negated()}. Options that stream their values, having none retained, are changed
+	 * when the digest of their streamed values differs, see {@see fingerprint()}. The non-option arguments are not compared.
+	 * @param previous The parse result to compare from.
+	 * @param current The parse result to compare to.
+	 * @return The differences, ordered by key.
+	 */
+	static std::vector< Difference > diff(
+		const ParseResult& previous,
+		const ParseResult& current )
+	{
+		std::vector< Difference > differences;
+
+		_mergeOptions( previous.mParsedOptions, current.mParsedOptions,
+			[ &differences ]( const std::string& key, const OptionArgument* previousOption, const OptionArgument* currentOption )
+			{
+				size_t previousSize = ( nullptr == previousOption ) ? 0 : previousOption->mOptionValues.size();
+				size_t currentSize = ( nullptr == currentOption ) ? 0 : currentOption->mOptionValues.size();
+				std::vector< size_t > changedValues;
+
+				if ( ( nullptr != previousOption ) and ( nullptr != currentOption ) )
+				{
+					for ( size_t index( 0 ), count( std::min( previousSize, currentSize ) ); index < count; ++index )
+					{
+						if ( previousOption->mOptionValues[ index ] != currentOption->mOptionValues[ index ] )
+						{
+							changedValues.push_back( index );
+						}
+					}
+
+					if ( changedValues.empty() and ( previousSize == currentSize )
+						and ( previousOption->mGroupOffsets == currentOption->mGroupOffsets )
+						and ( not currentOption->mValueName.empty() or ( previousOption->mCount == currentOption->mCount ) )
+						and ( previousOption->mNegated == currentOption->mNegated )
+						and ( previousOption->mStreamDigest == currentOption->mStreamDigest ) )
+					{
+						return;
+					}
+				}
+
+				Difference::Kind kind = ( nullptr == previousOption ) ? Difference::Kind::added
+					: ( nullptr == currentOption ) ? Difference::Kind::removed
+					: Difference::Kind::changed;
+
+				differences.push_back( { key, kind, previousSize, currentSize, std::move( changedValues ) } );
+			} );
+
+		return differences;
+	}
+
+	/**
+	 * Write this parse result as JSON into {@param buffer}, replacing its contents but reusing its capacity.
+	 * The options are written as an object keyed by their valueName or option flag. Option flags that take
+	 * no value are written as true, and options that take a value as an array of their string values.
+	 * The non-option arguments are written as an array of strings. For example:
+	 * {"options":{"--flag":true,"InputFiles":["a.txt","b.txt"]},"arguments":["c.txt"]}
+	 * @param buffer The buffer to write the JSON to.
+	 */
+	void writeJson(
+		std::string& buffer ) const
+	{
+		buffer.clear();
+		buffer.append( "{\"options\":{" );
+
+		for ( auto parsedIter = mParsedOptions.begin(); mParsedOptions.end() != parsedIter; ++parsedIter )
+		{
+			const OptionArgument& optionArgument = parsedIter->second;
+
+			if ( mParsedOptions.begin() != parsedIter )
+			{
+				buffer.push_back( ',' );
+			}
+
+			_appendJsonString( buffer, parsedIter->first );
+			buffer.push_back( ':' );
+
+			if ( optionArgument.mValueName.empty() )
+			{
+				buffer.append( optionArgument.mNegated ? "false" : "true" );
+				continue;
+			}
+
+			// Options taking a number of values have an array per group of values
+			bool grouped = not optionArgument.mGroupOffsets.empty();
+			buffer.append( grouped ? "[[" : "[" );
+			for ( size_t index( 0 ), group( 1 ); index <= optionArgument.mOptionValues.size(); ++index )
+			{
+				for ( ; ( group < optionArgument.mGroupOffsets.size() ) and ( optionArgument.mGroupOffsets[ group ] == index ); ++group )
+				{
+					buffer.append( "],[" );
+				}
+
+				if ( optionArgument.mOptionValues.size() == index )
+				{
+					break;
+				}
+
+				if ( ( 0 != index ) and ( '[' != buffer.back() ) )
+				{
+					buffer.push_back( ',' );
+				}
+
+				_appendJsonString( buffer, optionArgument.mOptionValues[ index ] );
+			}
+			buffer.append( grouped ? "]]" : "]" );
+		}
+
+		buffer.append( "},\"arguments\":[" );
+		for ( size_t index( 0 ); index < mNonOptionArguments.size(); ++index )
+		{
+			if ( 0 != index )
+			{
+				buffer.push_back( ',' );
+			}
+
+			_appendJsonString( buffer, mNonOptionArguments[ index ] );
+		}
+		buffer.append( "]}" );
+	}
+
+	/**
+	 * Deserialize a parse result from the binary form written by {@see serialize()}.
+	 * No arguments are parsed, the options and values are read back as they were.
+	 * @param data Pointer to the serialized parse result.
+	 * @param size The number of bytes of the serialized parse result.
+	 * @return A shared pointer to the deserialized parse result.
+	 * @throw std::invalid_argument is thrown if the data is not a serialized parse result, or is truncated.
+	 */
+	static std::shared_ptr< const ParseResult > deserialize(
+		const void* data,
+		size_t size )
+	{
+		const char* position = static_cast< const char* >( data );
+		const char* end = position + size;
+		std::shared_ptr< ParseResult > parseResult( new ParseResult() );
+
+		if ( ( 4 > size ) or ( 0 != memcmp( position, _magic(), 4 ) ) )
+		{
+			throw std::invalid_argument( "The data is not a serialized parse result" );
+		}
+
+		position += 4;
+
+		std::string key;
+		for ( size_t count( _readCount( position, end, 9 * sizeof( uint64_t ) ) ); 0 < count; --count )
+		{
+			_read( position, end, key );
+			OptionArgument& optionArgument = parseResult->mParsedOptions.emplace_hint(
+				parseResult->mParsedOptions.end(), key, OptionArgument() )->second;
+
+			_read( position, end, optionArgument.mOptionString );
+			_read( position, end, optionArgument.mValueName );
+			optionArgument.mCount = static_cast< size_t >( _readInteger( position, end ) );
+			optionArgument.mNegated = ( 0 != _readInteger( position, end ) );
+			optionArgument.mFlags = _readInteger( position, end );
+			optionArgument.mStreamDigest = _readInteger( position, end );
+			optionArgument.mOptionValues.resize( _readCount( position, end, sizeof( uint64_t ) ) );
+			for ( auto& value : optionArgument.mOptionValues )
+			{
+				_read( position, end, value );
+			}
+			optionArgument.mGroupOffsets.resize( _readCount( position, end, sizeof( uint64_t ) ) );
+			for ( size_t index( 0 ); index < optionArgument.mGroupOffsets.size(); ++index )
+			{
+				optionArgument.mGroupOffsets[ index ] = static_cast< size_t >( _readInteger( position, end ) );
+
+				if ( ( optionArgument.mOptionValues.size() < optionArgument.mGroupOffsets[ index ] )
+					or ( ( 0 < index ) and ( optionArgument.mGroupOffsets[ index ] < optionArgument.mGroupOffsets[ index - 1 ] ) ) )
+				{
+					throw std::invalid_argument( "The serialized parse result has an invalid value group" );
+				}
+			}
+			_read( position, end, optionArgument.mPathInformation );
+		}
+
+		parseResult->mNonOptionArguments.resize( _readCount( position, end, sizeof( uint64_t ) ) );
+		for ( auto& argument : parseResult->mNonOptionArguments )
+		{
+			_read( position, end, argument );
+		}
+		_read( position, end, parseResult->mNonOptionPathInformation );
+
+		return parseResult;
+	}
+
+	/**
+	 * Serialize this parse result into a compact binary form, to be handed to another process,
+	 * for instance through a memfd or an inherited pipe, and read back with {@see deserialize()}.
+	 * The binary form holds no pointers, only lengths, and is in the byte order of this machine.
+	 * @return A string holding the serialized parse result.
+	 */
+	std::string serialize() const
+	{
+		size_t size = 4 + 3 * sizeof( uint64_t );
+		for ( const auto& parsedIter : mParsedOptions )
+		{
+			const OptionArgument& optionArgument = parsedIter.second;
+			size += 10 * sizeof( uint64_t ) + parsedIter.first.size() + optionArgument.mOptionString.size()
+				+ optionArgument.mValueName.size() + optionArgument.mPathInformation.size() * ( 1 + sizeof( uint64_t ) )
+				+ optionArgument.mGroupOffsets.size() * sizeof( uint64_t );
+			for ( const auto& value : optionArgument.mOptionValues )
+			{
+				size += sizeof( uint64_t ) + value.size();
+			}
+		}
+		for ( const auto& argument : mNonOptionArguments )
+		{
+			size += sizeof( uint64_t ) + argument.size();
+		}
+		size += mNonOptionPathInformation.size() * ( 1 + sizeof( uint64_t ) );
+
+		std::string buffer;
+		buffer.reserve( size );
+		buffer.append( _magic(), 4 );
+
+		_write( buffer, static_cast< uint64_t >( mParsedOptions.size() ) );
+		for ( const auto& parsedIter : mParsedOptions )
+		{
+			const OptionArgument& optionArgument = parsedIter.second;
+			_write( buffer, parsedIter.first );
+			_write( buffer, optionArgument.mOptionString );
+			_write( buffer, optionArgument.mValueName );
+			_write( buffer, static_cast< uint64_t >( optionArgument.mCount ) );
+			_write( buffer, static_cast< uint64_t >( optionArgument.mNegated ) );
+			_write( buffer, optionArgument.mFlags );
+			_write( buffer, optionArgument.mStreamDigest );
+			_write( buffer, static_cast< uint64_t >( optionArgument.mOptionValues.size() ) );
+			for ( const auto& value : optionArgument.mOptionValues )
+			{
+				_write( buffer, value );
+			}
+			_write( buffer, static_cast< uint64_t >( optionArgument.mGroupOffsets.size() ) );
+			for ( const auto& offset : optionArgument.mGroupOffsets )
+			{
+				_write( buffer, static_cast< uint64_t >( offset ) );
+			}
+			_write( buffer, optionArgument.mPathInformation );
+		}
+
+		_write( buffer, static_cast< uint64_t >( mNonOptionArguments.size() ) );
+		for ( const auto& argument : mNonOptionArguments )
+		{
+			_write( buffer, argument );
+		}
+		_write( buffer, mNonOptionPathInformation );
+
+		return buffer;
+	}
+
+	/**
+	 * Check if a key is present in the parsed options map. Unlike {@see ArgumentParser::hasParsedOption()},
+	 * option flags that have an associated valueName must be looked up by their valueName.
+	 * @param optionOrValueName Const reference to the option flag, or valueName to check for in the parsed options map.
+	 * @return True is returned if the key is present in the parsed options map.
+	 */
+	bool hasParsedOption(
+		const std::string& optionOrValueName ) const
+	{
+		return mParsedOptions.end() != mParsedOptions.find( optionOrValueName );
+	}
+
+	/**
+	 * Get a value of an option converted to {@tparam Type}, see {@see OptionArgument::get()}.
+	 * As with {@see hasParsedOption()}, option flags that have an associated valueName must be looked up by their valueName.
+	 * @param optionOrValueName Const reference to the option flag, or valueName of the option.
+	 * @param index Index of value to retrieve. [default: 0]
+	 * @return The converted value.
+	 * @throw std::out_of_range is thrown if the option is not present, or no value exists at the given index.
+	 * @throw std::invalid_argument is thrown if a value cannot be converted.
+	 */
+	template < typename Type >
+	Type get(
+		const std::string& optionOrValueName,
+		size_t index = 0 ) const
+	{
+		return mParsedOptions.at( optionOrValueName ).get< Type >( index );
+	}
+};
+
+/**
+ * This class is responsible for building a command line argument parser
+ * and being called upon to parse and handle command line arguments.
+ * The options, and everything else set up before parsing, may be added to from any thread, even while
+ * another is parsing: the changes are collected in a working copy of the schema, published as a whole when
+ * next read, and each parse, including {@see reloadArguments()} and {@see parseRuntimeArguments()}, reads
+ * the schema it started with. Parses only lock to publish pending changes, never while reading the schema.
+ */
+class ArgumentParser
+{
+public:
+
+	/**
+	 * This enumeration flags whether or not a value
+	 * is required, optional, or not expected for a given option flag.
+	 */
+	enum class OptionValue : int
+	{
+		none,      ///< No value is expected for the option flag.
+		optional,  ///< Any value present is optional for the option flag.
+		required,  ///< A value is required for the option flag.
+		negatable  ///< No value is expected for the option flag, which is negated when prefixed with "--no-".
+	};
+
+	/**
+	 * This enumeration flags which value to take
+	 * should an option flag be present more than once.
+	 */
+	enum class OptionSelection : int
+	{
+		take_first,  ///< Take only the first value for the option flag.
+		take_last,   ///< Take only the last value for the option flag.
+		take_all,    ///< Take all values for the option flag.
+		take_unique, ///< Take all distinct values for the option flag, in the order first given.
+		stream       ///< Hand each value to the callback as it is parsed, without retaining any values.
+	};
+
+	/**
+	 * This enumeration flags how the values of an option
+	 * are to be validated as file system paths after parsing.
+	 */
+	enum class PathValidation : int
+	{
+		none,      ///< The values are not validated as paths.
+		exists,    ///< The values must name existing paths.
+		readable   ///< The values must name existing, readable paths.
+	};
+
+	/**
+	 * This enumeration flags how many of the non-option arguments a positional argument takes.
+	 */
+	enum class PositionalArity : int
+	{
+		single,    ///< Exactly one argument is taken.
+		optional,  ///< One argument is taken, if present.
+		remainder  ///< All of the remaining arguments are taken, as a single group.
+	};
+
+	/**
+	 * The maximum number of values for an option taking any number of values, see {@see setOptionValueCount()}.
+	 */
+	static const size_t UNLIMITED_VALUES = std::numeric_limits< size_t >::max();
+
+	/**
+	 * A description of an option, holding the parameters of {@see addOption()}. Descriptors hold only
+	 * pointers and values, so arrays of them can be constant initialized, and added in bulk with {@see addOptions()}.
+	 * Null strings are taken as empty strings.
+	 */
+	struct OptionDescriptor
+	{
+		const char* optionString;                                   ///< The option flag.
+		const char* valueName;                                      ///< The name of the value.
+		bool required;                                              ///< The option is required to be present.
+		const char* helpString;                                     ///< The help string of the option.
+		ArgumentParser::OptionValue valueRequired;                  ///< Whether a value is required for the option flag.
+		ArgumentParser::OptionSelection selection;                  ///< Which value to take, should the option flag appear more than once.
+		void ( *callback )( const std::string& value );             ///< The callback called each time the option flag is found.
+		const char* defaultValue;                                   ///< The default string value.
+	};
+
+private:
+
+	// The fixed vocabulary of a flag-set option, looked up through a perfect hash built when the vocabulary is set.
+	// Each name is a bit of the mask, in the order of the vocabulary.
+	class _FlagSet
+	{
+	private:
+
+		std::vector< std::string > mNames;
+		std::vector< uint8_t > mSlots;
+		uint64_t mSeed;
+		size_t mSlotMask;
+
+		// FNV-1a, seeded
+		static uint64_t _hash(
+			const char* name,
+			size_t length,
+			uint64_t seed )
+		{
+			uint64_t hash = 0xcbf29ce484222325ULL ^ seed;
+
+			for ( size_t index( 0 ); index < length; ++index )
+			{
+				hash = ( hash ^ static_cast< unsigned char >( name[ index ] ) ) * 0x100000001b3ULL;
+			}
+
+			return hash ^ ( hash >> 29 );
+		}
+
+	public:
+
+		explicit _FlagSet(
+			const std::vector< std::string >& names ) :
+			mNames( names ),
+			mSeed( 0 ),
+			mSlotMask( 0 )
+		{
+			// Search for a seed, growing the table as needed, under which no two names share a slot
+			for ( size_t slotCount( 2 ); ; slotCount *= 2 )
+			{
+				if ( slotCount < names.size() )
+				{
+					continue;
+				}
+
+				for ( mSeed = 0; 256 > mSeed; ++mSeed )
+				{
+					mSlots.assign( slotCount, 0 );
+					mSlotMask = slotCount - 1;
+					size_t index( 0 );
+
+					for ( ; index < names.size(); ++index )
+					{
+						uint8_t& slot = mSlots[ _hash( names[ index ].data(), names[ index ].size(), mSeed ) & mSlotMask ];
+
+						if ( 0 != slot )
+						{
+							break;
+						}
+
+						slot = static_cast< uint8_t >( index + 1 );
+					}
+
+					if ( names.size() == index )
+					{
+						return;
+					}
+				}
+			}
+		}
+
+		// Apply a comma separated list of names to the mask. Names prefixed with '-' are cleared,
+		// those prefixed with '+', or not prefixed, are set. Unknown names are reported and ignored.
+		uint64_t apply(
+			uint64_t flags,
+			const std::string& value,
+			const std::string& optionString ) const
+		{
+			for ( size_t begin( 0 ), end; begin <= value.size(); begin = end + 1 )
+			{
+				end = value.find( ',', begin );
+				end = ( std::string::npos == end ) ? value.size() : end;
+
+				size_t nameBegin = begin;
+				bool clear = ( nameBegin < end ) and ( '-' == value[ nameBegin ] );
+				nameBegin += ( ( nameBegin < end ) and ( ( '-' == value[ nameBegin ] ) or ( '+' == value[ nameBegin ] ) ) ) ? 1 : 0;
+
+				if ( nameBegin == end )
+				{
+					continue;
+				}
+
+				const char* name = value.data() + nameBegin;
+				size_t length = end - nameBegin;
+				uint8_t slot = mSlots[ _hash( name, length, mSeed ) & mSlotMask ];
+
+				if ( ( 0 == slot ) or ( 0 != mNames[ slot - 1 ].compare( 0, std::string::npos, name, length ) ) )
+				{
+					fprintf( stderr, "Unknown flag \"%.*s\" for option: %s\n", static_cast< int >( length ), name, optionString.c_str() );
+					continue;
+				}
+
+				uint64_t bit = uint64_t( 1 ) << ( slot - 1 );
+				flags = clear ? ( flags & ~bit ) : ( flags | bit );
+			}
+
+			return flags;
+		}
+	};
+
+	class _OptionHandler
+	{
+	public:
+
+		std::string defaultStringValue;
+		std::string valueName;
+		std::function< void( const std::string& ) > callback;
+		ArgumentParser::OptionValue valueRequired;
+		ArgumentParser::OptionSelection selection;
+		std::string helpString;
+		bool requiredOption;
+		ArgumentParser::PathValidation pathValidation;
+		bool runtimeMutable;
+		size_t ordinal;
+		std::shared_ptr< const _FlagSet > flagSet;
+		size_t minimumValues;
+		size_t maximumValues;
+
+	private:
+
+		// move assignment
+		void _moveAssign(
+			_OptionHandler&& other )
+		{
+			this->defaultStringValue = std::move( other.defaultStringValue );
+			this->valueName = std::move( other.valueName );
+			this->callback = std::exchange( other.callback, nullptr );
+			this->valueRequired = std::exchange( other.valueRequired, ArgumentParser::OptionValue::optional );
+			this->selection = std::exchange( other.selection, ArgumentParser::OptionSelection::take_last );
+			this->helpString = std::move( other.helpString );
+			this->requiredOption = std::exchange( other.requiredOption, false );
+			this->pathValidation = std::exchange( other.pathValidation, ArgumentParser::PathValidation::none );
+			this->runtimeMutable = std::exchange( other.runtimeMutable, false );
+			this->ordinal = std::exchange( other.ordinal, 0 );
+			this->flagSet = std::move( other.flagSet );
+			this->minimumValues = std::exchange( other.minimumValues, 0 );
+			this->maximumValues = std::exchange( other.maximumValues, 0 );
+		}
+
+		// copy assignment
+		void _copyAssign(
+			const _OptionHandler& other )
+		{
+			this->defaultStringValue = other.defaultStringValue;
+			this->valueName = other.valueName;
+			this->callback = other.callback;
+			this->valueRequired = other.valueRequired;
+			this->selection = other.selection;
+			this->helpString = other.helpString;
+			this->requiredOption = other.requiredOption;
+			this->pathValidation = other.pathValidation;
+			this->runtimeMutable = other.runtimeMutable;
+			this->ordinal = other.ordinal;
+			this->flagSet = other.flagSet;
+			this->minimumValues = other.minimumValues;
+			this->maximumValues = other.maximumValues;
+		}
+
+	public:
+
+		// default constructor
+		_OptionHandler()
+		{
+			this->defaultStringValue = std::string( "" );
+			this->valueName = std::string( "" );
+			this->callback = nullptr;
+			this->valueRequired = ArgumentParser::OptionValue::optional;
+			this->selection = ArgumentParser::OptionSelection::take_last;
+			this->helpString = std::string( "" );
+			this->requiredOption = false;
+			this->pathValidation = ArgumentParser::PathValidation::none;
+			this->runtimeMutable = false;
+			this->ordinal = 0;
+			this->minimumValues = 0;
+			this->maximumValues = 0;
+		}
+
+		// move constructor
+		_OptionHandler(
+			_OptionHandler&& other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		// copy constructor
+		_OptionHandler(
+			const _OptionHandler& other )
+		{
+			_copyAssign( other );
+		}
+
+		// move assignment operator
+		_OptionHandler& operator=(
+			_OptionHandler&& other )
+		{
+			if ( this != &other )
+			{
+				_moveAssign( std::move( other ) );
+			}
+
+			return *this;
+		}
+
+		// copy assignment operator
+		_OptionHandler& operator=(
+			const _OptionHandler& other )
+		{
+			if ( this != &other )
+			{
+				_copyAssign( other );
+			}
+
+			return *this;
+		}
+	};
+
+	class _OptionGroup
+	{
+	public:
+
+		std::vector< uint64_t > mask;
+		std::vector< std::string > optionStrings;
+		bool mutuallyExclusive;
+		bool required;
+	};
+
+	class _OptionConstraints
+	{
+	public:
+
+		std::vector< uint64_t > requirements;
+		std::vector< uint64_t > conflicts;
+	};
+
+	class _PositionalArgument
+	{
+	public:
+
+		std::string name;
+		std::string helpString;
+		ArgumentParser::PositionalArity arity;
+	};
+
+	// Everything set up before parsing. A schema is never changed once published: changes are made to a copy,
+	// which then replaces it, so each parse reads the one schema it started with, without locking.
+	class _Schema
+	{
+	public:
+
+		// Application description
+		std::string applicationDescription;
+
+		// Options to be handled
+		std::map< std::string, _OptionHandler > optionsHandlerMap;
+		std::map< std::string, std::string > optionsValueNames;
+		std::vector< std::string > optionOrdinals;
+
+		// Positional arguments, filled in order from the non-option arguments
+		std::vector< _PositionalArgument > positionalArguments;
+
+		// Option groups, checked against the options seen with a bitmask per group
+		std::vector< _OptionGroup > optionGroups;
+
+		// Options required by, and conflicting with, each option, indexed by option ordinal
+		std::vector< _OptionConstraints > optionConstraints;
+
+		// Configuration files applied to the options not present in the command line arguments
+		std::vector< std::string > configurationFiles;
+
+		// Environment variables bound to option flags, indexed by variable name
+		std::map< std::string, std::string > environmentBindings;
+
+		// Path validation of the non-option arguments
+		ArgumentParser::PathValidation nonOptionPathValidation = ArgumentParser::PathValidation::none;
+
+		// Unknown option flags are skipped silently
+		bool ignoreUnknownOptions = false;
+	};
+
+	// Set - The published schema, accessed atomically
+	mutable std::shared_ptr< const _Schema > mSchema;
+
+	// Set - The changes made since the schema was last published, collected in a single working copy.
+	// The working copy is guarded by the schema mutex; readers check the flag before taking the mutex to publish it.
+	mutable std::shared_ptr< _Schema > mPendingSchema;
+	mutable std::atomic< bool > mSchemaPending{ false };
+	mutable std::mutex mSchemaMutex;
+
+	// Parsed - Options parsed
+	std::vector< uint64_t > mSeenOptions;
+	std::map< std::string, OptionArgument > mParsedOptions;
+	std::vector< std::string > mNonOptionArguments;
+	std::vector< OptionArgument::PathInformation > mNonOptionPathInformation;
+	std::vector< std::string > mCommandLineArguments;
+
+	// Parsed - Snapshot of the parsed options published to readers, accessed atomically
+	std::shared_ptr< const ParseResult > mParseResult;
+
+	// Reload - Callbacks are dispatched after the changes are known
+	bool mSuppressCallbacks = false;
+
+	// Reload - Values streamed while the callbacks are suppressed, indexed by parsed key,
+	// handed to the callbacks of the streamed options that changed once the changes are known
+	std::map< std::string, std::vector< std::string > > mDeferredStreamValues;
+
+	// Parsing - Values already taken by the options selecting unique values, indexed by parsed key.
+	// Each value is held once, by the option argument; here it is only its hash and its index in the values.
+	std::map< std::string, std::unordered_multimap< size_t, size_t > > mUniqueValues;
+
+	// Parsing - The contents of the configuration file being applied, its capacity reused across files and reloads
+	std::string mConfigurationBuffer;
+
+	// Move assignment
+	void _moveAssign(
+		ArgumentParser&& other )
+	{
+		_discardPendingSchema();
+		std::atomic_store( &mSchema, other._loadSchema() );
+		std::atomic_store( &other.mSchema, std::make_shared< const _Schema >() );
+		mSeenOptions = std::move( other.mSeenOptions );
+		mParsedOptions = std::move( other.mParsedOptions );
+		mNonOptionArguments = std::move( other.mNonOptionArguments );
+		mNonOptionPathInformation = std::move( other.mNonOptionPathInformation );
+		mCommandLineArguments = std::move( other.mCommandLineArguments );
+		std::atomic_store( &mParseResult, std::atomic_exchange( &other.mParseResult, std::make_shared< const ParseResult >() ) );
+	}
+
+	// Copy assignment, the schema is shared as it is never changed in place
+	void _copyAssign(
+		const ArgumentParser& other )
+	{
+		_discardPendingSchema();
+		std::atomic_store( &mSchema, other._loadSchema() );
+		mSeenOptions = other.mSeenOptions;
+		mParsedOptions = other.mParsedOptions;
+		mNonOptionArguments = other.mNonOptionArguments;
+		mNonOptionPathInformation = other.mNonOptionPathInformation;
+		mCommandLineArguments = other.mCommandLineArguments;
+		std::atomic_store( &mParseResult, std::atomic_load( &other.mParseResult ) );
+	}
+
+	// Apply a change to the working copy of the schema, copying the published schema only for the first change
+	// since it was last published, so that adding options one at a time does not copy the schema each time.
+	// Changes are serialized, and each one validates before it changes anything. Parses in flight keep the schema they started with.
+	template < typename Change >
+	void _changeSchema(
+		Change change )
+	{
+		std::lock_guard< std::mutex > lock( mSchemaMutex );
+
+		if ( nullptr == mPendingSchema )
+		{
+			mPendingSchema = std::make_shared< _Schema >( *std::atomic_load( &mSchema ) );
+		}
+
+		change( *mPendingSchema );
+		mSchemaPending.store( true );
+	}
+
+	// Get the schema, publishing the working copy first should there be changes since it was last published.
+	// The mutex is only taken to publish, so parsing with a published schema never waits on it.
+	std::shared_ptr< const _Schema > _loadSchema() const
+	{
+		if ( mSchemaPending.load() )
+		{
+			std::lock_guard< std::mutex > lock( mSchemaMutex );
+
+			if ( mSchemaPending.load() )
+			{
+				std::atomic_store( &mSchema, std::shared_ptr< const _Schema >( std::move( mPendingSchema ) ) );
+				mPendingSchema.reset();
+				mSchemaPending.store( false );
+			}
+		}
+
+		return std::atomic_load( &mSchema );
+	}
+
+	// Drop the changes not yet published, for the schema is replaced as a whole
+	void _discardPendingSchema()
+	{
+		std::lock_guard< std::mutex > lock( mSchemaMutex );
+		mPendingSchema.reset();
+		mSchemaPending.store( false );
+	}
+
+	// Publish a snapshot of the parsed options to readers
+	void _publishParseResult()
+	{
+		std::atomic_store( &mParseResult, std::shared_ptr< const ParseResult >(
+			new ParseResult( mParsedOptions, mNonOptionArguments, mNonOptionPathInformation ) ) );
+	}
+
+	// Assign a converted value to a bound member, appending to vectors
+	template < typename Type >
+	static void _assignBoundValue(
+		Type& member,
+		const std::string& value )
+	{
+		member = ArgumentValueTraits< Type >::convert( value );
+	}
+
+	template < typename Type, typename Allocator >
+	static void _assignBoundValue(
+		std::vector< Type, Allocator >& member,
+		const std::string& value )
+	{
+		member.push_back( ArgumentValueTraits< Type >::convert( value ) );
+	}
+
+	// The valueName of a bound option, the option flag without its leading dashes, uppercased, with '-' replaced by '_'
+	static std::string _bindValueName(
+		const std::string& optionString )
+	{
+		std::string valueName( _normalizeOptionString( optionString ).substr( 2 ) );
+
+		for ( auto& character : valueName )
+		{
+			character = ( '-' == character ) ? '_' : static_cast< char >( toupper( static_cast< unsigned char >( character ) ) );
+		}
+
+		return valueName;
+	}
+
+	// Normalize the option string, that is: make sure it starts with "--"
+	static std::string _normalizeOptionString(
+		const std::string& optionString )
+	{
+		if ( optionString.empty() )
+		{
+			throw std::invalid_argument( "Option string may not be empty" );
+		}
+
+		if ( '-' != optionString[ 0 ] )
+		{
+			return "--" + optionString;
+		}
+		else if ( ( 2 <= optionString.length() ) and ( '-' != optionString[ 1 ] ) )
+		{
+			return "-" + optionString;
+		}
+		else if ( 3 <= optionString.length() )
+		{
+			return optionString;
+		}
+
+		throw std::invalid_argument( "Option string must have more than just \"--\"" );
+	}
+
+	// Check that the path is readable by the process, setting errno if not
+	static bool _isReadable(
+		const std::string& path )
+	{
+#ifdef _WIN32
+		return 0 == _access( path.c_str(), 4 );
+#else
+		return 0 == access( path.c_str(), R_OK );
+#endif
+	}
+
+	// Validate the values of options flagged for path validation, along with the non-option
+	// arguments if flagged, and cache the path information. The paths are checked in parallel.
+	// Returns the error message of every path that failed validation.
+	std::vector< std::string > _validatePaths(
+		const _Schema& schema )
+	{
+		static const size_t MINIMUM_PATHS_PER_THREAD = 64;
+
+		struct PathJob
+		{
+			const std::string* path;
+			OptionArgument::PathInformation* information;
+			ArgumentParser::PathValidation validation;
+			int error;
+		};
+
+		std::vector< PathJob > jobs;
+
+		for ( auto& parsedIter : mParsedOptions )
+		{
+			OptionArgument& optionArgument = parsedIter.second;
+			auto mapIterator = schema.optionsHandlerMap.find( optionArgument.mOptionString );
+
+			if ( ( schema.optionsHandlerMap.end() == mapIterator )
+				or ( ArgumentParser::PathValidation::none == mapIterator->second.pathValidation ) )
+			{
+				continue;
+			}
+
+			optionArgument.mPathInformation.assign( optionArgument.mOptionValues.size(), OptionArgument::PathInformation() );
+			for ( size_t index( 0 ); index < optionArgument.mOptionValues.size(); ++index )
+			{
+				jobs.push_back( { &optionArgument.mOptionValues[ index ],
+					&optionArgument.mPathInformation[ index ], mapIterator->second.pathValidation, 0 } );
+			}
+		}
+
+		mNonOptionPathInformation.clear();
+		if ( ArgumentParser::PathValidation::none != schema.nonOptionPathValidation )
+		{
+			mNonOptionPathInformation.assign( mNonOptionArguments.size(), OptionArgument::PathInformation() );
+			for ( size_t index( 0 ); index < mNonOptionArguments.size(); ++index )
+			{
+				jobs.push_back( { &mNonOptionArguments[ index ],
+					&mNonOptionPathInformation[ index ], schema.nonOptionPathValidation, 0 } );
+			}
+		}
+
+		auto validateRange = [ &jobs ]( size_t begin, size_t end )
+		{
+			for ( size_t index( begin ); index < end; ++index )
+			{
+				PathJob& job = jobs[ index ];
+				struct stat pathStatus;
+
+				if ( 0 != stat( job.path->c_str(), &pathStatus ) )
+				{
+					job.error = errno;
+					continue;
+				}
+
+				job.information->directory = S_IFDIR == ( pathStatus.st_mode & S_IFMT );
+				job.information->size = static_cast< uint64_t >( pathStatus.st_size );
+
+				if ( ( ArgumentParser::PathValidation::readable == job.validation )
+					and not _isReadable( *job.path ) )
+				{
+					job.error = errno;
+				}
+			}
+		};
+
+		// Split the paths into contiguous chunks, one per thread; the calling thread takes the first chunk.
+		size_t threadCount = std::max< size_t >( 1, std::thread::hardware_concurrency() );
+		threadCount = std::max< size_t >( 1, std::min( threadCount, jobs.size() / MINIMUM_PATHS_PER_THREAD ) );
+		size_t chunkSize = ( jobs.size() + threadCount - 1 ) / threadCount;
+		std::vector< std::thread > threads;
+		threads.reserve( threadCount - 1 );
+		size_t threadIndex( 1 );
+
+		try
+		{
+			for ( ; threadIndex < threadCount; ++threadIndex )
+			{
+				size_t begin = std::min( jobs.size(), threadIndex * chunkSize );
+				threads.emplace_back( validateRange, begin, std::min( jobs.size(), begin + chunkSize ) );
+			}
+		}
+		catch ( const std::system_error& )
+		{
+			// No more threads could be started, the calling thread takes the chunks left over
+		}
+
+		validateRange( 0, std::min( jobs.size(), chunkSize ) );
+
+		for ( ; threadIndex < threadCount; ++threadIndex )
+		{
+			size_t begin = std::min( jobs.size(), threadIndex * chunkSize );
+			validateRange( begin, std::min( jobs.size(), begin + chunkSize ) );
+		}
+
+		for ( auto& thread : threads )
+		{
+			thread.join();
+		}
+
+		std::vector< std::string > invalidPaths;
+		for ( const auto& job : jobs )
+		{
+			if ( 0 != job.error )
+			{
+				invalidPaths.push_back( *job.path + ": " + strerror( job.error ) );
+			}
+		}
+
+		return invalidPaths;
+	}
+
+	// Check that a value has not been taken yet by an option selecting unique values, noting it as taken at the end of the values.
+	// The values are looked up by hash, then compared in place, so no copy of them is kept.
+	bool _takeUniqueValue(
+		const std::string& parsedKey,
+		const std::vector< std::string >& values,
+		const std::string& value )
+	{
+		std::unordered_multimap< size_t, size_t >& uniqueValues = mUniqueValues[ parsedKey ];
+		size_t hash = std::hash< std::string >()( value );
+		auto range = uniqueValues.equal_range( hash );
+
+		for ( auto iterator = range.first; range.second != iterator; ++iterator )
+		{
+			if ( ( iterator->second < values.size() ) and ( values[ iterator->second ] == value ) )
+			{
+				return false;
+			}
+		}
+
+		uniqueValues.emplace( hash, values.size() );
+		return true;
+	}
+
+	// Remove an option from the parsed options, along with any values it streamed while the callbacks were suppressed
+	void _eraseParsedOption(
+		const std::string& parsedKey )
+	{
+		mParsedOptions.erase( parsedKey );
+		mDeferredStreamValues.erase( parsedKey );
+	}
+
+	// Apply a value for the option flag, according to how the handler selects its values
+	void _applyOptionValue(
+		const std::string& argument,
+		const _OptionHandler& handler,
+		const std::string& optionValue )
+	{
+		const std::string& parsedKey = handler.valueName.empty() ? argument : handler.valueName;
+		auto parsedIterator = mParsedOptions.find( parsedKey );
+		bool firstOccurrence = ( mParsedOptions.end() == parsedIterator );
+
+		if ( firstOccurrence )
+		{
+			// Regardless of which value is selected, if nothing is present we insert the first.
+			// Streamed values are only handed to the callback, the option is only marked as present.
+			parsedIterator = mParsedOptions.insert( { parsedKey, OptionArgument( argument, handler.valueName ) } ).first;
+
+			// Start over with the values seen for unique values
+			if ( ArgumentParser::OptionSelection::take_unique == handler.selection )
+			{
+				mUniqueValues[ parsedKey ].clear();
+				_takeUniqueValue( parsedKey, parsedIterator->second.mOptionValues, optionValue );
+			}
+
+			if ( not handler.valueName.empty() and ( ArgumentParser::OptionSelection::stream != handler.selection ) )
+			{
+				parsedIterator->second.mOptionValues.push_back( optionValue );
+			}
+		}
+		else if ( not handler.valueName.empty() )
+		{
+			OptionArgument& optionArgument = parsedIterator->second;
+
+			// Take only the last value
+			if ( ArgumentParser::OptionSelection::take_last == handler.selection )
+			{
+				optionArgument.mOptionValues[ 0 ] = optionValue;
+				optionArgument._clearConvertedValues();
+			}
+
+			// Push it to the vector, we're taking all the values
+			if ( ArgumentParser::OptionSelection::take_all == handler.selection )
+			{
+				optionArgument.mOptionValues.push_back( optionValue );
+				optionArgument._clearConvertedValues();
+			}
+
+			// Push it to the vector only if it has not been taken yet
+			if ( ( ArgumentParser::OptionSelection::take_unique == handler.selection )
+				and _takeUniqueValue( parsedKey, optionArgument.mOptionValues, optionValue ) )
+			{
+				optionArgument.mOptionValues.push_back( optionValue );
+				optionArgument._clearConvertedValues();
+			}
+		}
+
+		// Streamed values are only kept as a digest, to tell whether they changed
+		if ( ArgumentParser::OptionSelection::stream == handler.selection )
+		{
+			parsedIterator->second._foldStreamValue( optionValue );
+		}
+
+		// Count every occurrence, without allocating for repeated option flags
+		++parsedIterator->second.mCount;
+
+		// Flag-set options decode their value into the bitmask; all occurrences are combined by setting and
+		// clearing bits, the last occurrence starts from an empty mask, and the first is kept as is.
+		if ( nullptr != handler.flagSet )
+		{
+			OptionArgument& optionArgument = parsedIterator->second;
+
+			if ( firstOccurrence or ( ArgumentParser::OptionSelection::take_last == handler.selection ) )
+			{
+				optionArgument.mFlags = handler.flagSet->apply( 0, optionValue, argument );
+			}
+			else if ( ArgumentParser::OptionSelection::take_first != handler.selection )
+			{
+				optionArgument.mFlags = handler.flagSet->apply( optionArgument.mFlags, optionValue, argument );
+			}
+		}
+
+		// Negatable option flags take the state of their last occurrence, given as "true" or "false"
+		if ( ArgumentParser::OptionValue::negatable == handler.valueRequired )
+		{
+			parsedIterator->second.mNegated = not ArgumentValueTraits< bool >::convert( optionValue );
+		}
+
+		// Check for a callback, deferring streamed values while the callbacks are suppressed
+		if ( ( nullptr != handler.callback ) and not mSuppressCallbacks )
+		{
+			handler.callback( optionValue );
+		}
+		else if ( ( nullptr != handler.callback ) and ( ArgumentParser::OptionSelection::stream == handler.selection ) )
+		{
+			mDeferredStreamValues[ parsedKey ].push_back( optionValue );
+		}
+
+		_markSeen( handler.ordinal );
+	}
+
+	// Apply the values given together by one occurrence of an option flag taking a number of values,
+	// according to how the handler selects its values. Each occurrence retained is a group of values.
+	void _applyOptionGroup(
+		const std::string& argument,
+		const _OptionHandler& handler,
+		const std::string* valuesBegin,
+		const std::string* valuesEnd )
+	{
+		auto parsedIterator = mParsedOptions.find( handler.valueName );
+		bool firstOccurrence = ( mParsedOptions.end() == parsedIterator );
+
+		if ( firstOccurrence )
+		{
+			parsedIterator = mParsedOptions.insert( { handler.valueName, OptionArgument( argument, handler.valueName ) } ).first;
+		}
+
+		OptionArgument& optionArgument = parsedIterator->second;
+
+		if ( ArgumentParser::OptionSelection::stream == handler.selection )
+		{
+			// Streamed values are only handed to the callback, and kept as a digest
+			for ( const std::string* value = valuesBegin; valuesEnd != value; ++value )
+			{
+				optionArgument._foldStreamValue( *value );
+			}
+		}
+		else if ( firstOccurrence or ( ArgumentParser::OptionSelection::take_last == handler.selection ) )
+		{
+			optionArgument.mOptionValues.assign( valuesBegin, valuesEnd );
+			optionArgument.mGroupOffsets.assign( 1, 0 );
+			optionArgument._clearConvertedValues();
+		}
+		else if ( ArgumentParser::OptionSelection::take_all == handler.selection )
+		{
+			optionArgument.mGroupOffsets.push_back( optionArgument.mOptionValues.size() );
+			optionArgument.mOptionValues.insert( optionArgument.mOptionValues.end(), valuesBegin, valuesEnd );
+			optionArgument._clearConvertedValues();
+		}
+
+		++optionArgument.mCount;
+
+		// Check for a callback, handing it each value of the group, deferring streamed values while the callbacks are suppressed
+		if ( ( nullptr != handler.callback ) and not mSuppressCallbacks )
+		{
+			for ( const std::string* value = valuesBegin; valuesEnd != value; ++value )
+			{
+				handler.callback( *value );
+			}
+		}
+		else if ( ( nullptr != handler.callback ) and ( ArgumentParser::OptionSelection::stream == handler.selection ) )
+		{
+			std::vector< std::string >& deferredValues = mDeferredStreamValues[ handler.valueName ];
+			deferredValues.insert( deferredValues.end(), valuesBegin, valuesEnd );
+		}
+
+		_markSeen( handler.ordinal );
+	}
+
+	// Count the values following the option flag at index that are taken by an option flag taking a number of values
+	static size_t _countGroupValues(
+		const _OptionHandler& handler,
+		const std::vector< std::string >& arguments,
+		size_t index )
+	{
+		size_t valueCount( 0 );
+
+		for ( ++index; ( index < arguments.size() ) and ( valueCount < handler.maximumValues )
+			and ( 0 != arguments[ index ].compare( 0, 2, "--" ) ); ++index )
+		{
+			++valueCount;
+		}
+
+		return valueCount;
+	}
+
+	// Split a value at whitespace into the values of a group, for the configuration files and the environment
+	static void _splitGroupValues(
+		const char* begin,
+		const char* end,
+		std::vector< std::string >& values )
+	{
+		values.clear();
+
+		while ( begin < end )
+		{
+			for ( ; ( begin < end ) and isspace( static_cast< unsigned char >( *begin ) ); ++begin );
+			const char* valueEnd = begin;
+			for ( ; ( valueEnd < end ) and not isspace( static_cast< unsigned char >( *valueEnd ) ); ++valueEnd );
+
+			if ( begin < valueEnd )
+			{
+				values.emplace_back( begin, static_cast< size_t >( valueEnd - begin ) );
+			}
+
+			begin = valueEnd;
+		}
+	}
+
+	// Find the handler of an option flag, recognizing the "--no-" prefix of negatable option flags.
+	// The negated option flag is only rebuilt, into the reused buffer, when the option flag is not found as is.
+	static std::map< std::string, _OptionHandler >::const_iterator _findOptionHandler(
+		const _Schema& schema,
+		const std::string& argument,
+		std::string& negatedBuffer,
+		bool& negated )
+	{
+		auto mapIterator = schema.optionsHandlerMap.find( argument );
+		negated = false;
+
+		if ( ( schema.optionsHandlerMap.end() == mapIterator ) and ( 0 == argument.compare( 0, 5, "--no-" ) ) )
+		{
+			negatedBuffer.assign( "--" ).append( argument, 5, std::string::npos );
+			auto negatedIterator = schema.optionsHandlerMap.find( negatedBuffer );
+
+			if ( ( schema.optionsHandlerMap.end() != negatedIterator )
+				and ( ArgumentParser::OptionValue::negatable == negatedIterator->second.valueRequired ) )
+			{
+				negated = true;
+				return negatedIterator;
+			}
+		}
+
+		return mapIterator;
+	}
+
+	// Find the ordinal of an option flag
+	static size_t _optionOrdinal(
+		const _Schema& schema,
+		const std::string& optionString )
+	{
+		std::string normalizedOptionString( _normalizeOptionString( optionString ) );
+		auto mapIterator = schema.optionsHandlerMap.find( normalizedOptionString );
+
+		if ( schema.optionsHandlerMap.end() == mapIterator )
+		{
+			throw std::invalid_argument( "The handler for option \"" + normalizedOptionString + "\" is not defined" );
+		}
+
+		return mapIterator->second.ordinal;
+	}
+
+	// Set the bit of the ordinal in the mask
+	static void _setBit(
+		std::vector< uint64_t >& mask,
+		size_t ordinal )
+	{
+		if ( mask.size() <= ( ordinal / 64 ) )
+		{
+			mask.resize( ordinal / 64 + 1, 0 );
+		}
+
+		mask[ ordinal / 64 ] |= static_cast< uint64_t >( 1 ) << ( ordinal % 64 );
+	}
+
+	// Add an option and handler for the option to the schema, see {@see addOption()}
+	static void _addOption(
+		_Schema& schema,
+		const std::string& optionString,
+		const std::string& valueName,
+		bool required,
+		const std::string& helpString,
+		ArgumentParser::OptionValue valueRequired,
+		ArgumentParser::OptionSelection selection,
+		const std::function< void( const std::string& ) >& callback,
+		const std::string& defaultValue )
+	{
+		// TODO: Check that the valueName and optionStrings to not collide.
+
+		std::string normalizedOptionString( _normalizeOptionString( optionString ) );
+
+		// Check that the normalized option string does not equal "--help", ignoring case.
+		if ( 0 == strcasecmp( "--help", normalizedOptionString.c_str() ) )
+		{
+			throw std::invalid_argument( "The normalized option string may not be \"--help\"" );
+		}
+
+		// For required and optional values, make sure that the valueName isn't already taken,
+		// nor that its valueName collides with an option flag that doesn't take any values.
+		if ( ( ArgumentParser::OptionValue::required == valueRequired )
+			or ( ArgumentParser::OptionValue::optional == valueRequired ) )
+		{
+			// TODO: If valueName is empty, then just use the optionString
+			// Check for empty
+			if ( valueName.empty() )
+			{
+				throw std::invalid_argument( "The valueName may not be the empty string for option flags with an optional or required value" );
+			}
+
+			// Check that valueName isn't already taken
+			if ( schema.optionsValueNames.end() != schema.optionsValueNames.find( valueName ) )
+			{
+				throw std::invalid_argument( "The given valueName \"" + valueName + "\" has already been claimed" );
+			}
+
+			// Check that valueName isn't the name of a positional argument
+			for ( const auto& positional : schema.positionalArguments )
+			{
+				if ( valueName == positional.name )
+				{
+					throw std::invalid_argument( "The given valueName \"" + valueName + "\" collides with the positional argument: " + valueName );
+				}
+			}
+
+			// Check that valueName doesn't collide with an option flag that takes no values,
+			// both no_value and negatable option flags are parsed under their option flag.
+			auto mapIterator = schema.optionsHandlerMap.find( valueName );
+
+			if ( schema.optionsHandlerMap.end() != mapIterator )
+			{
+				const auto& optionHandler = mapIterator->second;
+
+				if ( ( ArgumentParser::OptionValue::none == optionHandler.valueRequired )
+					or ( ArgumentParser::OptionValue::negatable == optionHandler.valueRequired ) )
+				{
+					throw std::invalid_argument( "The given valueName \"" + valueName + "\" collides with the option flag taking no values: " + mapIterator->first );
+				}
+			}
+		}
+		else
+		{
+			// Check that the option flag doesn't collide with a claimed valueName
+			if ( schema.optionsValueNames.end() != schema.optionsValueNames.find( normalizedOptionString ) )
+			{
+				throw std::invalid_argument( "The given option flag \"" + normalizedOptionString + "\" collides with the valueName: " + normalizedOptionString );
+			}
+		}
+
+		// Check that the negation of a negatable option flag doesn't collide with another option flag
+		if ( ArgumentParser::OptionValue::negatable == valueRequired )
+		{
+			std::string negatedOptionString( "--no-" + normalizedOptionString.substr( 2 ) );
+
+			if ( schema.optionsHandlerMap.end() != schema.optionsHandlerMap.find( negatedOptionString ) )
+			{
+				throw std::invalid_argument( "The negated option flag \"" + negatedOptionString + "\" collides with the option flag: " + negatedOptionString );
+			}
+		}
+		else if ( 0 == normalizedOptionString.compare( 0, 5, "--no-" ) )
+		{
+			auto negatableIterator = schema.optionsHandlerMap.find( "--" + normalizedOptionString.substr( 5 ) );
+
+			if ( ( schema.optionsHandlerMap.end() != negatableIterator )
+				and ( ArgumentParser::OptionValue::negatable == negatableIterator->second.valueRequired ) )
+			{
+				throw std::invalid_argument( "The given option flag \"" + normalizedOptionString + "\" collides with the negatable option flag: " + negatableIterator->first );
+			}
+		}
+
+		// Streamed values have nowhere to go without a callback
+		if ( ( ArgumentParser::OptionSelection::stream == selection ) and ( nullptr == callback ) )
+		{
+			throw std::invalid_argument( "The option \"" + normalizedOptionString + "\" streams its values and requires a callback" );
+		}
+
+		// Check that we don't already have a handler for the option flag
+		if ( schema.optionsHandlerMap.end() != schema.optionsHandlerMap.find( normalizedOptionString ) )
+		{
+			throw std::invalid_argument( "The handler for option \"" + normalizedOptionString + "\" is already defined" );
+		}
+
+		// Create the option handler
+		_OptionHandler handler;
+		handler.defaultStringValue = defaultValue;
+		if ( ( ArgumentParser::OptionValue::required == valueRequired )
+			or ( ArgumentParser::OptionValue::optional == valueRequired ) )
+		{
+			handler.valueName = valueName;
+			schema.optionsValueNames[ valueName ] = normalizedOptionString;
+		}
+		handler.callback = callback;
+		handler.valueRequired = valueRequired;
+		handler.selection = selection;
+		handler.helpString = helpString;
+		handler.requiredOption = required;
+		handler.ordinal = schema.optionOrdinals.size();
+		schema.optionOrdinals.push_back( normalizedOptionString );
+
+		// Add the option handler to the map
+		schema.optionsHandlerMap[ normalizedOptionString ] = std::move( handler );
+	}
+
+	// Add an option group with the mask of its option ordinals
+	static void _addOptionGroup(
+		_Schema& schema,
+		const std::vector< std::string >& optionStrings,
+		bool mutuallyExclusive,
+		bool required )
+	{
+		_OptionGroup group;
+		group.mutuallyExclusive = mutuallyExclusive;
+		group.required = required;
+
+		for ( const auto& optionString : optionStrings )
+		{
+			size_t ordinal = _optionOrdinal( schema, optionString );
+			_setBit( group.mask, ordinal );
+			group.optionStrings.push_back( schema.optionOrdinals[ ordinal ] );
+		}
+
+		schema.optionGroups.push_back( std::move( group ) );
+	}
+
+	// Set the bit of the option ordinal in the options seen
+	void _markSeen(
+		size_t ordinal )
+	{
+		_setBit( mSeenOptions, ordinal );
+	}
+
+	// Check the bit of the option ordinal in the options seen
+	bool _isSeen(
+		size_t ordinal ) const
+	{
+		return ( ( ordinal / 64 ) < mSeenOptions.size() )
+			and ( 0 != ( mSeenOptions[ ordinal / 64 ] & ( static_cast< uint64_t >( 1 ) << ( ordinal % 64 ) ) ) );
+	}
+
+	// Index of the lowest bit set in a non-zero word
+	static size_t _lowestBit(
+		uint64_t word )
+	{
+#if defined( __GNUC__ ) or defined( __clang__ )
+		return static_cast< size_t >( __builtin_ctzll( word ) );
+#else
+		size_t bit = 0;
+		for ( ; 0 == ( word & 1 ); word >>= 1, ++bit );
+		return bit;
+#endif
+	}
+
+	// Check the option groups and constraints against the options seen.
+	// Each group intersects its mask with the options seen a word at a time, counting the words
+	// with any bit set and flagging words with more than one. Then, for each option seen, its
+	// requirements are masked with the options not seen, and its conflicts with the options seen.
+	// Returns the error message of every violation.
+	std::vector< std::string > _checkConstraints(
+		const _Schema& schema ) const
+	{
+		std::vector< std::string > violations;
+
+		for ( const auto& group : schema.optionGroups )
+		{
+			size_t wordsPresent = 0;
+			bool multiplePresent = false;
+
+			for ( size_t index( 0 ), count( std::min( group.mask.size(), mSeenOptions.size() ) ); index < count; ++index )
+			{
+				uint64_t present = group.mask[ index ] & mSeenOptions[ index ];
+
+				if ( 0 != present )
+				{
+					multiplePresent = multiplePresent or ( 0 != ( present & ( present - 1 ) ) );
+					++wordsPresent;
+				}
+			}
+
+			multiplePresent = multiplePresent or ( 1 < wordsPresent );
+
+			if ( group.mutuallyExclusive and multiplePresent )
+			{
+				violations.push_back( "Only one of " + _joinOptionStrings( group.optionStrings )
+					+ " may be present, found: " + _joinOptionStrings( _seenOptionStrings( schema, group.mask ) ) );
+			}
+			else if ( group.required and ( 0 == wordsPresent ) )
+			{
+				violations.push_back( ( group.mutuallyExclusive ? "One of " : "At least one of " )
+					+ _joinOptionStrings( group.optionStrings ) + " is required" );
+			}
+		}
+
+		for ( size_t index( 0 ); index < mSeenOptions.size(); ++index )
+		{
+			for ( uint64_t seen( mSeenOptions[ index ] ); 0 != seen; seen &= seen - 1 )
+			{
+				size_t ordinal = index * 64 + _lowestBit( seen );
+
+				if ( schema.optionConstraints.size() <= ordinal )
+				{
+					break;
+				}
+
+				const _OptionConstraints& constraints = schema.optionConstraints[ ordinal ];
+				std::vector< std::string > missing;
+
+				for ( size_t word( 0 ); word < constraints.requirements.size(); ++word )
+				{
+					uint64_t absent = constraints.requirements[ word ]
+						& ~( ( word < mSeenOptions.size() ) ? mSeenOptions[ word ] : 0 );
+
+					for ( ; 0 != absent; absent &= absent - 1 )
+					{
+						missing.push_back( schema.optionOrdinals[ word * 64 + _lowestBit( absent ) ] );
+					}
+				}
+
+				if ( not missing.empty() )
+				{
+					violations.push_back( schema.optionOrdinals[ ordinal ] + " requires " + _joinOptionStrings( missing ) );
+				}
+
+				std::vector< std::string > conflicting( _seenOptionStrings( schema, constraints.conflicts ) );
+				if ( not conflicting.empty() )
+				{
+					violations.push_back( schema.optionOrdinals[ ordinal ] + " conflicts with " + _joinOptionStrings( conflicting ) );
+				}
+			}
+		}
+
+		return violations;
+	}
+
+	// The option flags of the bits set in both the mask and the options seen
+	std::vector< std::string > _seenOptionStrings(
+		const _Schema& schema,
+		const std::vector< uint64_t >& mask ) const
+	{
+		std::vector< std::string > optionStrings;
+
+		for ( size_t index( 0 ), count( std::min( mask.size(), mSeenOptions.size() ) ); index < count; ++index )
+		{
+			for ( uint64_t present( mask[ index ] & mSeenOptions[ index ] ); 0 != present; present &= present - 1 )
+			{
+				optionStrings.push_back( schema.optionOrdinals[ index * 64 + _lowestBit( present ) ] );
+			}
+		}
+
+		return optionStrings;
+	}
+
+	static std::string _joinOptionStrings(
+		const std::vector< std::string >& optionStrings )
+	{
+		std::string joined;
+
+		for ( const auto& optionString : optionStrings )
+		{
+			joined.append( joined.empty() ? optionString : ", " + optionString );
+		}
+
+		return joined;
+	}
+
+	// Apply the values of the bound environment variables to the options not present in the command line arguments.
+	// The environment is scanned once, each variable name is looked up in the index of bound variables.
+	// Values from the environment replace those of the configuration files.
+	void _applyEnvironment(
+		const _Schema& schema,
+		const std::set< std::string >& commandLineOptions )
+	{
+		if ( schema.environmentBindings.empty() )
+		{
+			return;
+		}
+
+#ifdef _WIN32
+		char** environment = _environ;
+#else
+		char** environment = environ;
+#endif
+		std::string variableName;
+		std::vector< std::string > groupValues;
+
+		for ( ; ( nullptr != environment ) and ( nullptr != *environment ); ++environment )
+		{
+			const char* separator = strchr( *environment, '=' );
+
+			if ( nullptr == separator )
+			{
+				continue;
+			}
+
+			variableName.assign( *environment, static_cast< size_t >( separator - *environment ) );
+			auto bindingIterator = schema.environmentBindings.find( variableName );
+
+			if ( schema.environmentBindings.end() == bindingIterator )
+			{
+				continue;
+			}
+
+			const std::string& optionString = bindingIterator->second;
+			const _OptionHandler& handler = schema.optionsHandlerMap.at( optionString );
+
+			// The command line takes precedence over the environment
+			if ( commandLineOptions.end() != commandLineOptions.find( optionString ) )
+			{
+				continue;
+			}
+
+			// The values of option flags taking a number of values are separated by whitespace
+			if ( 0 != handler.maximumValues )
+			{
+				_splitGroupValues( separator + 1, separator + 1 + strlen( separator + 1 ), groupValues );
+
+				// An empty variable does not set the option flag
+				if ( groupValues.empty() and ( '\0' == separator[ 1 ] ) )
+				{
+					continue;
+				}
+
+				if ( ( groupValues.size() < handler.minimumValues ) or ( handler.maximumValues < groupValues.size() ) )
+				{
+					fprintf( stderr, "Invalid number of values for environment variable: %s\n", variableName.c_str() );
+					continue;
+				}
+
+				_eraseParsedOption( handler.valueName );
+				_applyOptionGroup( optionString, handler, groupValues.data(), groupValues.data() + groupValues.size() );
+				continue;
+			}
+
+			std::string optionValue( separator + 1 );
+
+			if ( ArgumentParser::OptionValue::none == handler.valueRequired )
+			{
+				// An empty or false variable does not set the option flag
+				if ( optionValue.empty() )
+				{
+					continue;
+				}
+
+				try
+				{
+					if ( not ArgumentValueTraits< bool >::convert( optionValue ) )
+					{
+						continue;
+					}
+				}
+				catch ( const std::invalid_argument& )
+				{
+					fprintf( stderr, "Invalid boolean value for environment variable: %s\n", variableName.c_str() );
+					continue;
+				}
+
+				optionValue = handler.defaultStringValue;
+			}
+			else if ( ArgumentParser::OptionValue::negatable == handler.valueRequired )
+			{
+				// An empty variable does not set the option flag, otherwise it holds the boolean state
+				if ( optionValue.empty() )
+				{
+					continue;
+				}
+
+				try
+				{
+					optionValue = ArgumentValueTraits< bool >::convert( optionValue ) ? "true" : "false";
+				}
+				catch ( const std::invalid_argument& )
+				{
+					fprintf( stderr, "Invalid boolean value for environment variable: %s\n", variableName.c_str() );
+					continue;
+				}
+			}
+			else if ( optionValue.empty() and ( ArgumentParser::OptionValue::optional == handler.valueRequired ) )
+			{
+				optionValue = handler.defaultStringValue;
+			}
+
+			_eraseParsedOption( handler.valueName.empty() ? optionString : handler.valueName );
+			_applyOptionValue( optionString, handler, optionValue );
+		}
+	}
+
+	// Apply the key-value pairs of a configuration file in memory to the options not present in the command line arguments.
+	// Each line is of the form "key = value", "key value", or just "key" for option flags that take no value.
+	// The key is either the valueName or the option flag, with or without the leading "--". Empty lines,
+	// lines starting with '#' or ';', and section headers are skipped. The key and value buffers are reused across lines.
+	void _applyConfiguration(
+		const _Schema& schema,
+		const std::set< std::string >& commandLineOptions,
+		const char* begin,
+		const char* end )
+	{
+		std::string key;
+		std::string value;
+		std::string negatedKey;
+		bool negated;
+		std::vector< std::string > groupValues;
+
+		auto isSpace = []( char character )
+		{
+			return ( ' ' == character ) or ( '\t' == character ) or ( '\r' == character );
+		};
+
+		while ( begin < end )
+		{
+			const char* lineEnd = static_cast< const char* >( memchr( begin, '\n', static_cast< size_t >( end - begin ) ) );
+			lineEnd = ( nullptr == lineEnd ) ? end : lineEnd;
+
+			const char* position = begin;
+			const char* last = lineEnd;
+			begin = lineEnd + 1;
+
+			// Trim the line
+			for ( ; ( position < last ) and isSpace( *position ); ++position );
+			for ( ; ( position < last ) and isSpace( last[ -1 ] ); --last );
+
+			if ( ( position == last ) or ( '#' == *position ) or ( ';' == *position ) or ( '[' == *position ) )
+			{
+				continue;
+			}
+
+			// Split the key from the value
+			const char* keyEnd = position;
+			for ( ; ( keyEnd < last ) and ( '=' != *keyEnd ) and not isSpace( *keyEnd ); ++keyEnd );
+			key.assign( position, static_cast< size_t >( keyEnd - position ) );
+
+			if ( key.empty() )
+			{
+				continue;
+			}
+
+			const char* valueBegin = keyEnd;
+			for ( ; ( valueBegin < last ) and isSpace( *valueBegin ); ++valueBegin );
+			if ( ( valueBegin < last ) and ( '=' == *valueBegin ) )
+			{
+				for ( ++valueBegin; ( valueBegin < last ) and isSpace( *valueBegin ); ++valueBegin );
+			}
+
+			// Strip surrounding quotes from the value
+			const char* valueEnd = last;
+			if ( ( 2 <= ( valueEnd - valueBegin ) ) and ( '"' == *valueBegin ) and ( '"' == valueEnd[ -1 ] ) )
+			{
+				++valueBegin;
+				--valueEnd;
+			}
+
+			// Look up the key as a valueName, then as an option flag
+			auto valueNameIterator = schema.optionsValueNames.find( key );
+			if ( schema.optionsValueNames.end() != valueNameIterator )
+			{
+				key = valueNameIterator->second;
+			}
+			else if ( 0 != key.compare( 0, 2, "--" ) )
+			{
+				key.insert( 0, ( '-' == key[ 0 ] ) ? "-" : "--" );
+			}
+
+			auto mapIterator = _findOptionHandler( schema, key, negatedKey, negated );
+			if ( schema.optionsHandlerMap.end() == mapIterator )
+			{
+				fprintf( stderr, "Unknown configuration key: %.*s\n", static_cast< int >( keyEnd - position ), position );
+				continue;
+			}
+
+			// The command line takes precedence over the configuration files
+			if ( commandLineOptions.end() != commandLineOptions.find( mapIterator->first ) )
+			{
+				continue;
+			}
+
+			const _OptionHandler& handler = mapIterator->second;
+
+			// The values of option flags taking a number of values are separated by whitespace
+			if ( 0 != handler.maximumValues )
+			{
+				_splitGroupValues( valueBegin, valueEnd, groupValues );
+
+				if ( ( groupValues.size() < handler.minimumValues ) or ( handler.maximumValues < groupValues.size() ) )
+				{
+					fprintf( stderr, "Invalid number of values for configuration key: %s\n", key.c_str() );
+					continue;
+				}
+
+				_applyOptionGroup( mapIterator->first, handler, groupValues.data(), groupValues.data() + groupValues.size() );
+				continue;
+			}
+
+			if ( ArgumentParser::OptionValue::negatable == handler.valueRequired )
+			{
+				// The value, if any, is the boolean state, flipped by the "no-" prefix of the key
+				value.assign( valueBegin, static_cast< size_t >( valueEnd - valueBegin ) );
+
+				try
+				{
+					value = ( ArgumentValueTraits< bool >::convert( value ) != negated ) ? "true" : "false";
+				}
+				catch ( const std::invalid_argument& )
+				{
+					fprintf( stderr, "Invalid boolean value for configuration key: %s\n", key.c_str() );
+					continue;
+				}
+			}
+			else if ( ArgumentParser::OptionValue::none == handler.valueRequired )
+			{
+				// A value, if any, is the boolean state; a false value does not set the option flag
+				if ( valueBegin != valueEnd )
+				{
+					value.assign( valueBegin, static_cast< size_t >( valueEnd - valueBegin ) );
+
+					try
+					{
+						if ( not ArgumentValueTraits< bool >::convert( value ) )
+						{
+							continue;
+						}
+					}
+					catch ( const std::invalid_argument& )
+					{
+						fprintf( stderr, "Invalid boolean value for configuration key: %s\n", key.c_str() );
+						continue;
+					}
+				}
+
+				value = handler.defaultStringValue;
+			}
+			else if ( ( valueBegin == valueEnd ) and ( ArgumentParser::OptionValue::optional == handler.valueRequired ) )
+			{
+				value = handler.defaultStringValue;
+			}
+			else if ( valueBegin == valueEnd )
+			{
+				fprintf( stderr, "Required value not present for configuration key: %s\n", key.c_str() );
+				continue;
+			}
+			else
+			{
+				value.assign( valueBegin, static_cast< size_t >( valueEnd - valueBegin ) );
+			}
+
+			_applyOptionValue( mapIterator->first, handler, value );
+		}
+	}
+
+	// Read the configuration file into the configuration buffer and apply it. Files that do not exist are skipped.
+	// The file is read rather than mapped, as a file truncated while mapped would fault on access.
+	void _applyConfigurationFile(
+		const _Schema& schema,
+		const std::set< std::string >& commandLineOptions,
+		const std::string& filePath )
+	{
+		size_t length = 0;
+
+#ifdef _WIN32
+		FILE* file = fopen( filePath.c_str(), "rb" );
+		if ( nullptr == file )
+		{
+			if ( ENOENT != errno )
+			{
+				fprintf( stderr, "Unable to open configuration file: %s: %s\n", filePath.c_str(), strerror( errno ) );
+			}
+			return;
+		}
+
+		for ( size_t count( 1 ); 0 < count; length += count )
+		{
+			if ( mConfigurationBuffer.size() == length )
+			{
+				mConfigurationBuffer.resize( std::max< size_t >( 65536, 2 * length ) );
+			}
+
+			count = fread( &mConfigurationBuffer[ length ], 1, mConfigurationBuffer.size() - length, file );
+		}
+		fclose( file );
+#else
+		int fileDescriptor = open( filePath.c_str(), O_RDONLY | O_CLOEXEC );
+		if ( 0 > fileDescriptor )
+		{
+			if ( ENOENT != errno )
+			{
+				fprintf( stderr, "Unable to open configuration file: %s: %s\n", filePath.c_str(), strerror( errno ) );
+			}
+			return;
+		}
+
+		// Size the buffer for the whole file up front, with room to notice the end of file in the same pass
+		struct stat fileStatus;
+		if ( ( 0 == fstat( fileDescriptor, &fileStatus ) ) and ( mConfigurationBuffer.size() <= static_cast< size_t >( fileStatus.st_size ) ) )
+		{
+			mConfigurationBuffer.resize( static_cast< size_t >( fileStatus.st_size ) + 1 );
+		}
+
+		for ( ;; )
+		{
+			if ( mConfigurationBuffer.size() == length )
+			{
+				mConfigurationBuffer.resize( std::max< size_t >( 65536, 2 * length ) );
+			}
+
+			ssize_t count = read( fileDescriptor, &mConfigurationBuffer[ length ], mConfigurationBuffer.size() - length );
+
+			if ( 0 < count )
+			{
+				length += static_cast< size_t >( count );
+			}
+			else if ( 0 == count )
+			{
+				break;
+			}
+			else if ( EINTR != errno )
+			{
+				fprintf( stderr, "Unable to read configuration file: %s: %s\n", filePath.c_str(), strerror( errno ) );
+				close( fileDescriptor );
+				return;
+			}
+		}
+		close( fileDescriptor );
+#endif
+
+		_applyConfiguration( schema, commandLineOptions, mConfigurationBuffer.data(), mConfigurationBuffer.data() + length );
+	}
+
+	// Parse the stored command line arguments, along with the configuration files and the environment
+	void _parseArguments(
+		const _Schema& schema,
+		bool throwOnMissingOptions )
+	{
+		const std::vector< std::string >& arguments = mCommandLineArguments;
+		const char* application = arguments.empty() ? "" : arguments[ 0 ].c_str();
+		std::vector< std::string > missingOptions;
+		std::set< std::string > commandLineOptions;
+		std::string negatedOption;
+		bool negated;
+
+		// Iterate over arguments
+		for ( size_t index( 0 ); ++index < arguments.size(); )
+		{
+			const std::string& argument = arguments[ index ];
+			if ( 0 == argument.compare( 0, 2, "--" ) )
+			{
+				// Check for '--help' before anything else
+				if ( 0 == strcasecmp( "--help", argument.c_str() ) )
+				{
+					_printHelp( schema, application );
+					exit( EXIT_SUCCESS );
+				}
+
+				// Check if the option has a handler
+				auto mapIterator = _findOptionHandler( schema, argument, negatedOption, negated );
+
+				if ( schema.optionsHandlerMap.end() == mapIterator )
+				{
+					// Output an error message, then ignore
+					if ( not schema.ignoreUnknownOptions )
+					{
+						fprintf( stderr, "Unknown option flag: %s\n", argument.c_str() );
+					}
+					continue;
+				}
+				else if ( 0 != mapIterator->second.maximumValues )
+				{
+					// Take as many of the following values as the option flag accepts
+					const _OptionHandler& handler = mapIterator->second;
+					size_t valueCount = _countGroupValues( handler, arguments, index );
+
+					if ( valueCount < handler.minimumValues )
+					{
+						fprintf( stderr, "Required values not present for option: %s\n", argument.c_str() );
+						index += valueCount;
+						continue;
+					}
+
+					_applyOptionGroup( mapIterator->first, handler, arguments.data() + index + 1, arguments.data() + index + 1 + valueCount );
+					commandLineOptions.insert( mapIterator->first );
+					index += valueCount;
+				}
+				else
+				{
+					const _OptionHandler& handler = mapIterator->second;
+					std::string optionValue( handler.defaultStringValue );
+					bool hasNext = ( index + 1 ) < arguments.size();
+
+					// Get the value if applicable
+					if ( ArgumentParser::OptionValue::optional == handler.valueRequired )
+					{
+						if ( hasNext and ( 0 != arguments[ index + 1 ].compare( 0, 2, "--" ) ) )
+						{
+							optionValue.assign( arguments[ ++index ] );
+						}
+					}
+					else if ( ArgumentParser::OptionValue::required == handler.valueRequired )
+					{
+						if ( not hasNext )
+						{
+							fprintf( stderr, "Required value not present for option: %s\n", argument.c_str() );
+							continue;
+						}
+
+						optionValue.assign( arguments[ ++index ] );
+					}
+					else if ( ArgumentParser::OptionValue::negatable == handler.valueRequired )
+					{
+						optionValue.assign( negated ? "false" : "true" );
+					}
+
+					_applyOptionValue( mapIterator->first, handler, optionValue );
+					commandLineOptions.insert( mapIterator->first );
+				}
+			}
+			else
+			{
+				mNonOptionArguments.push_back( argument );
+			}
+		}
+
+		// Fall back to the configuration files, then the environment, for the options not present
+		for ( const auto& filePath : schema.configurationFiles )
+		{
+			_applyConfigurationFile( schema, commandLineOptions, filePath );
+		}
+
+		_applyEnvironment( schema, commandLineOptions );
+		mUniqueValues.clear();
+
+		// Check for missing required arguments
+		for ( const auto& handlerIter : schema.optionsHandlerMap )
+		{
+			if ( handlerIter.second.requiredOption and not _isSeen( handlerIter.second.ordinal ) )
+			{
+				missingOptions.push_back( handlerIter.first );
+			}
+		}
+
+		// Throw if we have missing required arguments
+		if ( not missingOptions.empty() )
+		{
+			if ( throwOnMissingOptions )
+			{
+				throw MissingRequiredOption( missingOptions );
+			}
+
+			_printHelp( schema, application, missingOptions );
+			exit( EXIT_FAILURE );
+		}
+
+		// Check the positional arguments, option groups, and constraints, reporting every violation together
+		std::vector< std::string > violations( _assignPositionalArguments( schema ) );
+		std::vector< std::string > constraintViolations( _checkConstraints( schema ) );
+		violations.insert( violations.end(), constraintViolations.begin(), constraintViolations.end() );
+		if ( not violations.empty() )
+		{
+			if ( throwOnMissingOptions )
+			{
+				throw OptionConstraintViolation( violations );
+			}
+
+			fprintf( stderr, "Error: Option Constraint Violations:\n" );
+			for ( const auto& violation : violations )
+			{
+				fprintf( stderr, "    %s\n", violation.c_str() );
+			}
+			exit( EXIT_FAILURE );
+		}
+
+		// Validate all of the paths at once, reporting every failure together
+		std::vector< std::string > invalidPaths( _validatePaths( schema ) );
+		if ( not invalidPaths.empty() )
+		{
+			if ( throwOnMissingOptions )
+			{
+				throw InvalidPathArguments( invalidPaths );
+			}
+
+			fprintf( stderr, "Error: Invalid Path Arguments:\n" );
+			for ( const auto& path : invalidPaths )
+			{
+				fprintf( stderr, "    %s\n", path.c_str() );
+			}
+			exit( EXIT_FAILURE );
+		}
+	}
+
+	// Fill the positional arguments, in order, from the non-option arguments. Each positional argument is
+	// stored in the parsed options map by its name, the remainder as a single group. Returns the count errors.
+	std::vector< std::string > _assignPositionalArguments(
+		const _Schema& schema )
+	{
+		std::vector< std::string > violations;
+
+		if ( schema.positionalArguments.empty() )
+		{
+			return violations;
+		}
+
+		size_t index( 0 );
+		for ( const auto& positional : schema.positionalArguments )
+		{
+			size_t count = mNonOptionArguments.size() - index;
+
+			if ( ArgumentParser::PositionalArity::remainder != positional.arity )
+			{
+				count = std::min< size_t >( count, 1 );
+			}
+
+			if ( ( 0 == count ) and ( ArgumentParser::PositionalArity::single == positional.arity ) )
+			{
+				violations.push_back( "Missing positional argument: " + positional.name );
+				continue;
+			}
+
+			if ( ( 0 == count ) and ( ArgumentParser::PositionalArity::optional == positional.arity ) )
+			{
+				continue;
+			}
+
+			OptionArgument& optionArgument = mParsedOptions.insert( { positional.name, OptionArgument( positional.name, positional.name ) } ).first->second;
+			optionArgument.mOptionValues.assign( mNonOptionArguments.begin() + index, mNonOptionArguments.begin() + index + count );
+			optionArgument.mCount = 1;
+
+			if ( ArgumentParser::PositionalArity::remainder == positional.arity )
+			{
+				optionArgument.mGroupOffsets.assign( 1, 0 );
+			}
+
+			index += count;
+		}
+
+		for ( ; index < mNonOptionArguments.size(); ++index )
+		{
+			violations.push_back( "Unexpected positional argument: " + mNonOptionArguments[ index ] );
+		}
+
+		return violations;
+	}
+
+	// Copy an argument of the range to be parsed
+	template < typename Argument >
+	static void _appendArgument(
+		std::vector< std::string >& arguments,
+		const Argument& argument )
+	{
+		arguments.emplace_back( argument );
+	}
+
+	static void _appendArgument(
+		std::vector< std::string >& arguments,
+		const char* argument )
+	{
+		if ( nullptr == argument )
+		{
+			throw std::invalid_argument( "Null pointer found in the middle of the arguments list." );
+		}
+
+		arguments.emplace_back( argument );
+	}
+
+	static void _appendArgument(
+		std::vector< std::string >& arguments,
+		char* argument )
+	{
+		_appendArgument( arguments, static_cast< const char* >( argument ) );
+	}
+
+	// Parse the range of arguments; the first is the application name
+	template < typename Iterator >
+	void _parseRange(
+		Iterator begin,
+		Iterator end,
+		bool throwOnMissingOptions )
+	{
+		std::vector< std::string > arguments;
+		arguments.reserve( static_cast< size_t >( std::distance( begin, end ) ) );
+
+		try
+		{
+			for ( ; end != begin; ++begin )
+			{
+				_appendArgument( arguments, *begin );
+			}
+		}
+		catch ( const std::invalid_argument& )
+		{
+			clear();
+			throw;
+		}
+
+		std::shared_ptr< const _Schema > schema( _loadSchema() );
+		mCommandLineArguments = std::move( arguments );
+		_parseArguments( *schema, throwOnMissingOptions );
+		_publishParseResult();
+	}
+
+	// Find the handler of a key in the parsed options map, that is: either a valueName or an option flag
+	static const _OptionHandler* _findHandler(
+		const _Schema& schema,
+		const std::string& parsedKey )
+	{
+		auto valueNameIterator = schema.optionsValueNames.find( parsedKey );
+		auto mapIterator = schema.optionsHandlerMap.find(
+			( schema.optionsValueNames.end() == valueNameIterator ) ? parsedKey : valueNameIterator->second );
+
+		return ( schema.optionsHandlerMap.end() == mapIterator ) ? nullptr : &mapIterator->second;
+	}
+
+	// Invoke the callbacks of the options whose values differ between the previous and the current parsed
+	// options, walking both ordered maps in a single merge pass. Options no longer present are handed their
+	// default value. Returns the keys of the options that changed.
+	std::vector< std::string > _dispatchChangedOptions(
+		const _Schema& schema,
+		const std::map< std::string, OptionArgument >& previousOptions )
+	{
+		std::vector< std::string > changedOptions;
+
+		ParseResult::_mergeOptions( previousOptions, mParsedOptions,
+			[ this, &schema, &changedOptions ]( const std::string& parsedKey, const OptionArgument* previous, const OptionArgument* current )
+			{
+				if ( ( nullptr != previous ) and ( nullptr != current ) and ( previous->mOptionValues == current->mOptionValues )
+					and ( previous->mGroupOffsets == current->mGroupOffsets )
+					and ( not current->mValueName.empty() or ( previous->mCount == current->mCount ) )
+					and ( previous->mNegated == current->mNegated )
+					and ( previous->mStreamDigest == current->mStreamDigest ) )
+				{
+					return;
+				}
+
+				changedOptions.push_back( parsedKey );
+				const _OptionHandler* handler = _findHandler( schema, parsedKey );
+
+				if ( ( nullptr == handler ) or ( nullptr == handler->callback ) )
+				{
+					return;
+				}
+
+				if ( ( nullptr == current ) or ( ArgumentParser::OptionValue::none == handler->valueRequired ) )
+				{
+					handler->callback( handler->defaultStringValue );
+				}
+				else if ( ArgumentParser::OptionValue::negatable == handler->valueRequired )
+				{
+					handler->callback( current->mNegated ? "false" : "true" );
+				}
+				else if ( ArgumentParser::OptionSelection::stream == handler->selection )
+				{
+					for ( const auto& value : mDeferredStreamValues[ parsedKey ] )
+					{
+						handler->callback( value );
+					}
+				}
+				else
+				{
+					for ( const auto& value : current->mOptionValues )
+					{
+						handler->callback( value );
+					}
+				}
+			} );
+
+		mDeferredStreamValues.clear();
+		return changedOptions;
+	}
+
+	// Format the valueName of an option flag taking a number of values, such as " X X [X ...]"
+	static std::string _formatGroupValueNames(
+		const _OptionHandler& handler )
+	{
+		std::string valueName( handler.valueName );
+		std::replace( valueName.begin(), valueName.end(), ' ', '_' );
+		std::string valueNames;
+
+		for ( size_t index( 0 ); index < handler.minimumValues; ++index )
 		{
-			_copyAssign( other );
+			valueNames += " " + valueName;
 		}
 
-		// move assignment operator
-		_OptionHandler& operator=(
-			_OptionHandler&& other )
+		if ( UNLIMITED_VALUES == handler.maximumValues )
 		{
-			if ( this != &other )
-			{
-				_moveAssign( std::move( other ) );
-			}
-
-			return *this;
+			valueNames += " [" + valueName + " ...]";
 		}
-
-		// copy assignment operator
-		_OptionHandler& operator=(
-			const _OptionHandler& other )
+		else
 		{
-			if ( this != &other )
+			for ( size_t index( handler.minimumValues ); index < handler.maximumValues; ++index )
 			{
-				_copyAssign( other );
+				valueNames += " [" + valueName + "]";
 			}
-
-			return *this;
 		}
-	};
-
-	// Set - Application description
-	std::string mApplicationDescription;
-
-	// Set - Options to be handled
-	std::map< std::string, _OptionHandler > mOptionsHandlerMap;
-	std::set< std::string > mOptionsValueNames;
-
-	// Parsed - Options parsed
-	std::map< std::string, bool > mRequiredOptions;
-	std::map< std::string, OptionArgument > mParsedOptions;
-	std::vector< std::string > mNonOptionArguments;
 
-	// Move assignment
-	void _moveAssign(
-		ArgumentParser&& other )
-	{
-		mApplicationDescription = std::move( other.mApplicationDescription );
-		mOptionsHandlerMap = std::move( other.mOptionsHandlerMap );
-		mOptionsValueNames = std::move( other.mOptionsValueNames );
-		mRequiredOptions = std::move( other.mRequiredOptions );
-		mParsedOptions = std::move( other.mParsedOptions );
-		mNonOptionArguments = std::move( other.mNonOptionArguments );
+		return valueNames;
 	}
 
-	// Copy assignment
-	void _copyAssign(
-		const ArgumentParser& other )
+	// Format the name of a positional argument by its arity, such as "NAME", "[NAME]", or "[NAME ...]"
+	static std::string _formatPositionalName(
+		const _PositionalArgument& positional )
 	{
-		mApplicationDescription = other.mApplicationDescription;
-		mOptionsHandlerMap = other.mOptionsHandlerMap;
-		mOptionsValueNames = other.mOptionsValueNames;
-		mRequiredOptions = other.mRequiredOptions;
-		mParsedOptions = other.mParsedOptions;
-		mNonOptionArguments = other.mNonOptionArguments;
+		std::string name( positional.name );
+		std::replace( name.begin(), name.end(), ' ', '_' );
+
+		if ( ArgumentParser::PositionalArity::optional == positional.arity )
+		{
+			return "[" + name + "]";
+		}
+		else if ( ArgumentParser::PositionalArity::remainder == positional.arity )
+		{
+			return "[" + name + " ...]";
+		}
+
+		return name;
 	}
 
 	// Print the help message
 	void _printHelp(
+		const _Schema& schema,
 		const char* application,
 		const std::vector< std::string >& missingOptions = std::vector< std::string >() ) const
 	{
@@ -357,11 +3443,21 @@ private:
 		fprintf( stderr, "Usage: %s", applicationName );
 		size_t usageLinePosition = usageIndent.length();
 
-		for ( const auto& handlerIter : mOptionsHandlerMap )
+		for ( const auto& handlerIter : schema.optionsHandlerMap )
 		{
 			std::string optionString( handlerIter.first );
 
-			if ( ArgumentParser::OptionValue::required == handlerIter.second.valueRequired )
+			if ( ArgumentParser::OptionValue::negatable == handlerIter.second.valueRequired )
+			{
+				// Negatable option flag
+				optionString.insert( 2, "[no-]" );
+			}
+			else if ( 0 != handlerIter.second.maximumValues )
+			{
+				// Number of values
+				optionString += _formatGroupValueNames( handlerIter.second );
+			}
+			else if ( ArgumentParser::OptionValue::required == handlerIter.second.valueRequired )
 			{
 				// Required value
 				std::string valueName( handlerIter.second.valueName );
@@ -396,6 +3492,21 @@ private:
 			usageLinePosition += optionString.length();
 		}
 
+		for ( const auto& positional : schema.positionalArguments )
+		{
+			std::string positionalString( " " + _formatPositionalName( positional ) );
+
+			// Move positional argument to next line
+			if ( MAX_LINE_LENGTH < ( usageLinePosition + positionalString.length() ) )
+			{
+				fprintf( stderr, "\n%s", usageIndent.c_str() );
+				usageLinePosition = usageIndent.length();
+			}
+
+			fprintf( stderr, "%s", positionalString.c_str() );
+			usageLinePosition += positionalString.length();
+		}
+
 		fprintf( stderr, "\n" );
 
 		if ( not missingOptions.empty() )
@@ -410,14 +3521,22 @@ private:
 		else
 		{
 			// Print the help message
-			fprintf( stderr, "\n%s\n\nOptions:\n", mApplicationDescription.c_str() );
+			fprintf( stderr, "\n%s\n\nOptions:\n", schema.applicationDescription.c_str() );
 			fprintf( stderr, "    --help              show this help message and exit\n" );
 
-			for ( const auto& handlerIter : mOptionsHandlerMap )
+			for ( const auto& handlerIter : schema.optionsHandlerMap )
 			{
 				std::string optionString( "    " + handlerIter.first );
 
-				if ( ArgumentParser::OptionValue::required == handlerIter.second.valueRequired )
+				if ( ArgumentParser::OptionValue::negatable == handlerIter.second.valueRequired )
+				{
+					optionString.insert( 6, "[no-]" );
+				}
+				else if ( 0 != handlerIter.second.maximumValues )
+				{
+					optionString += _formatGroupValueNames( handlerIter.second );
+				}
+				else if ( ArgumentParser::OptionValue::required == handlerIter.second.valueRequired )
 				{
 					std::string valueName( handlerIter.second.valueName );
 					std::replace( valueName.begin(), valueName.end(), ' ', '_' );
@@ -442,6 +3561,28 @@ private:
 						HELP_OPTION_PADDING.c_str(), handlerIter.second.helpString.c_str() );
 				}
 			}
+
+			if ( not schema.positionalArguments.empty() )
+			{
+				fprintf( stderr, "\nPositional Arguments:\n" );
+			}
+
+			for ( const auto& positional : schema.positionalArguments )
+			{
+				std::string positionalString( "    " + _formatPositionalName( positional ) );
+
+				if ( THRESHOLD_HELP_OPTION_LENGTH <= positionalString.length() )
+				{
+					fprintf( stderr, "%s\n%s%s\n", positionalString.c_str(),
+						HELP_OPTION_PADDING.c_str(), positional.helpString.c_str() );
+				}
+				else
+				{
+					fprintf( stderr, "%s%.*s%s\n", positionalString.c_str(),
+						static_cast< int >( HELP_OPTION_PADDING.length() - positionalString.length() ),
+						HELP_OPTION_PADDING.c_str(), positional.helpString.c_str() );
+				}
+			}
 		}
 	}
 
@@ -492,13 +3633,98 @@ public:
 		}
 	};
 
+	/**
+	 * This exception class is thrown when the parsed options violate the option groups or constraints,
+	 * see {@see addMutuallyExclusiveGroup()}, {@see addRequiredGroup()}, {@see addOptionConflict()},
+	 * and {@see addOptionRequirement()}, or the non-option arguments do not match the positional arguments,
+	 * see {@see addPositionalArgument()}, and {@see parseArguments()} is flagged to throw an exception instead of exiting.
+	 */
+	class OptionConstraintViolation : public std::exception
+	{
+	private:
+
+		friend class ArgumentParser;
+
+		std::string mMessage;
+		std::vector< std::string > mViolations;
+
+		OptionConstraintViolation(
+			const std::vector< std::string >& violations )
+		{
+			mViolations = violations;
+			mMessage = std::string( "\n\tOption constraint violations:" );
+			for ( const auto& violation : violations )
+			{
+				mMessage.append( "\n\t\t" + violation );
+			}
+			mMessage.append( "\n" );
+		}
+
+	public:
+		/**
+		 * A const pointer to the what string.
+		 * @return Pointer to the what message.
+		 */
+		const char* what() const noexcept
+		{
+			return mMessage.c_str();
+		}
+
+		/**
+		 * The message of each violation.
+		 * @return Const reference to the violation messages.
+		 */
+		const std::vector< std::string >& violations() const noexcept
+		{
+			return mViolations;
+		}
+	};
+
+	/**
+	 * This exception class is thrown when there are values that fail path validation,
+	 * see {@see setPathValidation()}, and {@see parseArguments()} is flagged to throw
+	 * an exception instead of exiting.
+	 */
+	class InvalidPathArguments : public std::exception
+	{
+	private:
+
+		friend class ArgumentParser;
+
+		std::string mMessage;
+
+		InvalidPathArguments(
+			const std::vector< std::string >& invalidPaths )
+		{
+			mMessage = std::string( "\n\tInvalid path arguments:" );
+			for ( const auto& path : invalidPaths )
+			{
+				mMessage.append( "\n\t\t" + path );
+			}
+			mMessage.append( "\n" );
+		}
+
+	public:
+		/**
+		 * A const pointer to the what string.
+		 * @return Pointer to the what message.
+		 */
+		const char* what() const noexcept
+		{
+			return mMessage.c_str();
+		}
+	};
+
 	/**
 	 * Default constructor.
 	 */
 	ArgumentParser(
 		const std::string& applicationDescription = std::string() )
 	{
-		mApplicationDescription = applicationDescription;
+		std::shared_ptr< _Schema > schema( std::make_shared< _Schema >() );
+		schema->applicationDescription = applicationDescription;
+		mSchema = std::move( schema );
+		mParseResult = std::make_shared< const ParseResult >();
 	}
 
 	/**
@@ -521,6 +3747,23 @@ public:
 		_copyAssign( other );
 	}
 
+	/**
+	 * Add a group of option flags of which at most one may be present, or exactly one if {@param required} is set.
+	 * The group is checked after parsing, see {@see parseArguments()}.
+	 * @param optionStrings The option flags of the group, as given to {@see addOption()}.
+	 * @param required Whether one of the option flags must be present. [default: false]
+	 * @throw std::invalid_argument is thrown if there is no handler defined for any of {@param optionStrings}.
+	 */
+	void addMutuallyExclusiveGroup(
+		const std::vector< std::string >& optionStrings,
+		bool required = false )
+	{
+		_changeSchema( [ & ]( _Schema& schema )
+			{
+				_addOptionGroup( schema, optionStrings, true, required );
+			} );
+	}
+
 	/**
 	 * Add an option and handler for the option.
 	 * @param optionString Any unique string to be representative of the option argument. The {@param optionString}
@@ -533,14 +3776,20 @@ public:
 	 *                  have a required or optional value. This value is ignored for options that do not take any value. [default: ""]
 	 * @param required Boolean indicating that this option is required to be present in the command line arguments. [default: false]
 	 * @param helpString A help string to be displayed when --help is present in the command line arguments. [default: ""]
-	 * @param valueRequired Define if a value is required for the option flag. [default: OptionValue::required]
-	 * @param selection Define which value to take, should the option flag appear more than once in the command line arguments. [default: OptionSelection::take_last]
+	 * @param valueRequired Define if a value is required for the option flag. With OptionValue::negatable, the option flag
+	 *                      is also recognized with the "--no-" prefix, and the {@param callback} is handed "true" or "false". [default: OptionValue::required]
+	 * @param selection Define which value to take, should the option flag appear more than once in the command line arguments.
+	 *                  With OptionSelection::stream, each value is handed to the {@param callback} while parsing continues and
+	 *                  no values are retained in the parsed options map, the option is only marked as present. [default: OptionSelection::take_last]
 	 * @param callback A pointer to a callback function to call each time the option flag is found. [default: nullptr]
 	 * @param defaultValue The default string value to be passed into the callback, should it be present, in the case
 	 *                     that an argument value is not either optional, and not present, or not expected. [default: ""]
 	 * @throw std::invalid_argument is thrown if the {@param optionString} is empty, equal to "--", or equal to "--help"
 	 * @throw std::invalid_argument is thrown if the {@param optionString} is already defined with a handler.
 	 * @throw std::invalid_argument is thrown if the {@param valueName} is already defined.
+	 * @throw std::invalid_argument is thrown if the {@param optionString}, or its negation for OptionValue::negatable,
+	 *                              collides with the negation of a negatable option flag, or an option flag.
+	 * @throw std::invalid_argument is thrown if {@param selection} is OptionSelection::stream and there is no {@param callback}.
 	 */
 	void addOption(
 		const std::string& optionString,
@@ -552,108 +3801,288 @@ public:
 		std::function< void( const std::string& ) > callback = nullptr,
 		const std::string& defaultValue = std::string() )
 	{
-		// TODO: Check that the valueName and optionStrings to not collide.
+		_changeSchema( [ & ]( _Schema& schema )
+			{
+				_addOption( schema, optionString, valueName, required, helpString, valueRequired, selection, callback, defaultValue );
+			} );
+	}
 
-		std::string normalizedOptionString;
+	/**
+	 * Add options in bulk from an array of descriptors, for instance ones gathered from many modules.
+	 * The options are added in the order given and published as one change to the schema, see {@see addOption()}.
+	 * Should any of them be rejected, none of the options of this call are added.
+	 * @param begin Pointer to the first descriptor.
+	 * @param end Pointer past the last descriptor.
+	 * @throw std::invalid_argument is thrown under the same conditions as {@see addOption()}, for any of the descriptors.
+	 */
+	void addOptions(
+		const ArgumentParser::OptionDescriptor* begin,
+		const ArgumentParser::OptionDescriptor* end )
+	{
+		auto toString = []( const char* string ) { return std::string( ( nullptr == string ) ? "" : string ); };
 
-		if ( optionString.empty() )
-		{
-			throw std::invalid_argument( "Option string may not be empty" );
-		}
+		_changeSchema( [ & ]( _Schema& schema )
+			{
+				size_t optionCount = schema.optionOrdinals.size();
 
-		// Normalize the optionString, that is: make sure it starts with "--"
-		if ( '-' != optionString[ 0 ] )
-		{
-			normalizedOptionString = "--" + optionString;
-		}
-		else if ( ( 2 <= optionString.length() ) and ( '-' != optionString[ 1 ] ) )
-		{
-			normalizedOptionString = "-" + optionString;
-		}
-		else if ( 3 <= optionString.length() )
-		{
-			normalizedOptionString = optionString;
-		}
-		else
-		{
-			throw std::invalid_argument( "Option string must have more than just \"--\"" );
-		}
+				try
+				{
+					for ( ; end != begin; ++begin )
+					{
+						_addOption( schema, toString( begin->optionString ), toString( begin->valueName ), begin->required, toString( begin->helpString ),
+							begin->valueRequired, begin->selection, begin->callback, toString( begin->defaultValue ) );
+					}
+				}
+				catch ( ... )
+				{
+					// Remove the options of this call added before the rejected one, rather than copying the schema up front
+					for ( size_t ordinal( optionCount ); ordinal < schema.optionOrdinals.size(); ++ordinal )
+					{
+						auto mapIterator = schema.optionsHandlerMap.find( schema.optionOrdinals[ ordinal ] );
+						schema.optionsValueNames.erase( mapIterator->second.valueName );
+						schema.optionsHandlerMap.erase( mapIterator );
+					}
 
-		// Check that the normalized option string does not equal "--help", ignoring case.
-		if ( 0 == strcasecmp( "--help", normalizedOptionString.c_str() ) )
-		{
-			throw std::invalid_argument( "The normalized option string may not be \"--help\"" );
-		}
+					schema.optionOrdinals.resize( optionCount );
+					throw;
+				}
+			} );
+	}
 
-		// For required and optional values, make sure that the valueName isn't already taken,
-		// nor that its valueName collides with an option flag that doesn't take any values.
-		if ( ( ArgumentParser::OptionValue::required == valueRequired )
-			or ( ArgumentParser::OptionValue::optional == valueRequired ) )
-		{
-			// TODO: If valueName is empty, then just use the optionString
-			// Check for empty
-			if ( valueName.empty() )
+	/**
+	 * Add options in bulk from an array of descriptors, see {@see addOptions( const OptionDescriptor*, const OptionDescriptor* )}.
+	 * @param descriptors The array of descriptors.
+	 * @throw std::invalid_argument is thrown under the same conditions as {@see addOption()}, for any of the descriptors.
+	 */
+	template < size_t Count >
+	void addOptions(
+		const ArgumentParser::OptionDescriptor ( &descriptors )[ Count ] )
+	{
+		addOptions( descriptors, descriptors + Count );
+	}
+
+	/**
+	 * Add a configuration file to be applied on each call to {@see parseArguments()}.
+	 * Each line of the file is of the form "key = value", "key value", or just "key" for option flags
+	 * that take no value. The key is either the valueName or the option flag, with or without the leading "--".
+	 * Empty lines, comments starting with '#' or ';', and "[section]" headers are skipped.
+	 * The configuration files are applied, in the order added, to the options not present in the command line arguments;
+	 * values of an option from several configuration files are merged according to its OptionSelection.
+	 * The values of bound environment variables replace those of the configuration files, see {@see bindEnvironmentVariable()}.
+	 * Configuration files that do not exist are skipped.
+	 * @param filePath The path to the configuration file.
+	 */
+	void addConfigurationFile(
+		const std::string& filePath )
+	{
+		_changeSchema( [ & ]( _Schema& schema )
 			{
-				throw std::invalid_argument( "The valueName may not be the empty string for option flags with an optional or required value" );
-			}
+				schema.configurationFiles.push_back( filePath );
+			} );
+	}
 
-			// Check that valueName isn't already taken
-			if ( mOptionsValueNames.end() != mOptionsValueNames.find( valueName ) )
+	/**
+	 * Add an option whose values are converted and written straight into a member of {@param structure}
+	 * as they are parsed, see {@see ArgumentValueTraits} for the conversions. The option streams its values,
+	 * see OptionSelection::stream, so no values are retained in the parsed options map. Members that are
+	 * std::vector have each value appended, other members take the last value. Option flags that take no
+	 * value convert their {@param defaultValue}, which for a bool member is true when left empty.
+	 * The valueName of the option, shown in the help message and keying the parsed options map, is the option flag
+	 * without its leading dashes, uppercased, with '-' replaced by '_', such as "MAX_THREADS" for "--max-threads".
+	 * On {@see reloadArguments()} and {@see parseRuntimeArguments()} the member is written again only when the values
+	 * of the option changed, compared by the digest of its streamed values.
+	 * @param structure Reference to the structure to write the values into. It must outlive the parsing.
+	 * @param member Pointer to the member of {@tparam Structure} to write the values into.
+	 * @param optionString The option flag, see {@see addOption()}.
+	 * @param required Boolean indicating that this option is required to be present in the command line arguments. [default: false]
+	 * @param helpString A help string to be displayed when --help is present in the command line arguments. [default: ""]
+	 * @param valueRequired Define if a value is required for the option flag. [default: OptionValue::required]
+	 * @param defaultValue The default string value to be converted in the case that a value is
+	 *                     either optional, and not present, or not expected. [default: ""]
+	 * @throw std::invalid_argument is thrown under the same conditions as {@see addOption()}.
+	 * @throw std::invalid_argument is thrown by {@see parseArguments()} if a value cannot be converted.
+	 */
+	template < typename Structure, typename Type >
+	void bindOption(
+		Structure& structure,
+		Type Structure::* member,
+		const std::string& optionString,
+		bool required = false,
+		const std::string& helpString = std::string(),
+		ArgumentParser::OptionValue valueRequired = ArgumentParser::OptionValue::required,
+		const std::string& defaultValue = std::string() )
+	{
+		Structure* destination = &structure;
+
+		addOption( optionString, _bindValueName( optionString ), required, helpString,
+			valueRequired, ArgumentParser::OptionSelection::stream,
+			[ destination, member ]( const std::string& value )
 			{
-				throw std::invalid_argument( "The given valueName \"" + valueName + "\" has already been claimed" );
-			}
+				_assignBoundValue( destination->*member, value );
+			},
+			defaultValue );
+	}
+
+	/**
+	 * Declare that two option flags conflict, that is: they may not both be present.
+	 * The constraint is checked after parsing, see {@see parseArguments()}.
+	 * @param optionString The option flag, as given to {@see addOption()}.
+	 * @param conflictingOptionString The option flag that conflicts with {@param optionString}.
+	 * @throw std::invalid_argument is thrown if there is no handler defined for either option flag.
+	 */
+	void addOptionConflict(
+		const std::string& optionString,
+		const std::string& conflictingOptionString )
+	{
+		_changeSchema( [ & ]( _Schema& schema )
+			{
+				size_t ordinal = _optionOrdinal( schema, optionString );
+				size_t conflictingOrdinal = _optionOrdinal( schema, conflictingOptionString );
+
+				if ( schema.optionConstraints.size() <= ordinal )
+				{
+					schema.optionConstraints.resize( ordinal + 1 );
+				}
+
+				_setBit( schema.optionConstraints[ ordinal ].conflicts, conflictingOrdinal );
+			} );
+	}
+
+	/**
+	 * Declare that an option flag requires another, that is: should {@param optionString} be present,
+	 * then {@param requiredOptionString} must also be present.
+	 * The constraint is checked after parsing, see {@see parseArguments()}.
+	 * @param optionString The option flag, as given to {@see addOption()}.
+	 * @param requiredOptionString The option flag required by {@param optionString}.
+	 * @throw std::invalid_argument is thrown if there is no handler defined for either option flag.
+	 */
+	void addOptionRequirement(
+		const std::string& optionString,
+		const std::string& requiredOptionString )
+	{
+		_changeSchema( [ & ]( _Schema& schema )
+			{
+				size_t ordinal = _optionOrdinal( schema, optionString );
+				size_t requiredOrdinal = _optionOrdinal( schema, requiredOptionString );
 
-			// Check that valueName doesn't collide with an option flag that takes no values.
-			auto mapIterator = mOptionsHandlerMap.find( valueName );
+				if ( schema.optionConstraints.size() <= ordinal )
+				{
+					schema.optionConstraints.resize( ordinal + 1 );
+				}
+
+				_setBit( schema.optionConstraints[ ordinal ].requirements, requiredOrdinal );
+			} );
+	}
+
+	/**
+	 * Add a positional argument, filled in the order added from the non-option arguments after parsing.
+	 * The positional argument is stored in the parsed options map by its {@param name}, so its values are accessible
+	 * with {@see get()} and {@see hasParsedOption()}. A remainder takes all of the remaining non-option arguments
+	 * as a single group, see {@see OptionArgument::group()}. Missing and unexpected non-option arguments are reported
+	 * together with the option constraints, see {@see OptionConstraintViolation}. The non-option arguments remain
+	 * accessible with {@see getNonOptionArguments()}. Without any positional arguments, the non-option arguments are not checked.
+	 * @param name The name of the positional argument, shown in the help message.
+	 * @param helpString A help string to be displayed when --help is present in the command line arguments. [default: ""]
+	 * @param arity How many of the non-option arguments are taken. [default: PositionalArity::single]
+	 * @throw std::invalid_argument is thrown if {@param name} is empty, starts with '-', or is already claimed
+	 *                              by a valueName or another positional argument.
+	 * @throw std::invalid_argument is thrown if a single positional argument would follow an optional one,
+	 *                              or any positional argument would follow a remainder.
+	 */
+	void addPositionalArgument(
+		const std::string& name,
+		const std::string& helpString = std::string(),
+		ArgumentParser::PositionalArity arity = ArgumentParser::PositionalArity::single )
+	{
+		_changeSchema( [ & ]( _Schema& schema )
+			{
+				if ( name.empty() or ( '-' == name[ 0 ] ) )
+				{
+					throw std::invalid_argument( "Invalid positional argument name: " + name );
+				}
+
+				if ( schema.optionsValueNames.end() != schema.optionsValueNames.find( name ) )
+				{
+					throw std::invalid_argument( "The positional argument \"" + name + "\" collides with the valueName: " + name );
+				}
+
+				for ( const auto& positional : schema.positionalArguments )
+				{
+					if ( name == positional.name )
+					{
+						throw std::invalid_argument( "The positional argument \"" + name + "\" is already defined" );
+					}
+
+					if ( ArgumentParser::PositionalArity::remainder == positional.arity )
+					{
+						throw std::invalid_argument( "The positional argument \"" + name + "\" follows the remainder: " + positional.name );
+					}
+
+					if ( ( ArgumentParser::PositionalArity::optional == positional.arity )
+						and ( ArgumentParser::PositionalArity::single == arity ) )
+					{
+						throw std::invalid_argument( "The positional argument \"" + name + "\" follows the optional positional argument: " + positional.name );
+					}
+				}
+
+				schema.positionalArguments.push_back( { name, helpString, arity } );
+			} );
+	}
+
+	/**
+	 * Add a group of option flags of which at least one must be present.
+	 * The group is checked after parsing, see {@see parseArguments()}.
+	 * @param optionStrings The option flags of the group, as given to {@see addOption()}.
+	 * @throw std::invalid_argument is thrown if there is no handler defined for any of {@param optionStrings}.
+	 */
+	void addRequiredGroup(
+		const std::vector< std::string >& optionStrings )
+	{
+		_changeSchema( [ & ]( _Schema& schema )
+			{
+				_addOptionGroup( schema, optionStrings, false, true );
+			} );
+	}
 
-			if ( mOptionsHandlerMap.end() != mapIterator )
+	/**
+	 * Bind an environment variable to an option flag.
+	 * Should the option flag not be present in the command line arguments, then the value of the
+	 * environment variable is used as the value of the option. Precedence is given to the command
+	 * line arguments, then the environment, then the configuration files, then the default value.
+	 * For option flags that take no value, the option flag is set by a true value of the variable, such as "1", "true",
+	 * "yes", or "on", and not set by a false one, such as "0", "false", "no", or "off", or an empty one.
+	 * The environment is scanned once per {@see parseArguments()} call, regardless of the number of bindings.
+	 * @param optionString The option flag, as given to {@see addOption()}.
+	 * @param variableName The name of the environment variable to bind to the option flag.
+	 * @throw std::invalid_argument is thrown if there is no handler defined for {@param optionString}.
+	 * @throw std::invalid_argument is thrown if {@param variableName} is empty or already bound.
+	 */
+	void bindEnvironmentVariable(
+		const std::string& optionString,
+		const std::string& variableName )
+	{
+		_changeSchema( [ & ]( _Schema& schema )
 			{
-				const auto& optionHandler = mapIterator->second;
+				std::string normalizedOptionString( _normalizeOptionString( optionString ) );
 
-				if ( ArgumentParser::OptionValue::none == optionHandler.valueRequired )
+				if ( schema.optionsHandlerMap.end() == schema.optionsHandlerMap.find( normalizedOptionString ) )
 				{
-					throw std::invalid_argument( "The given valueName \"" + valueName + "\" collides with the no_value option flag: " + mapIterator->first );
+					throw std::invalid_argument( "The handler for option \"" + normalizedOptionString + "\" is not defined" );
 				}
-			}
-		}
-		else
-		{
-			// Check that the option flag doesn't collide with a claimed valueName
-			if ( mOptionsValueNames.end() != mOptionsValueNames.find( normalizedOptionString ) )
-			{
-				throw std::invalid_argument( "The given option flag \"" + normalizedOptionString + "\" collides with the valueName: " + normalizedOptionString );
-			}
-		}
-
-		// Check that we don't already have a handler for the option flag
-		if ( mOptionsHandlerMap.end() != mOptionsHandlerMap.find( normalizedOptionString ) )
-		{
-			throw std::invalid_argument( "The handler for option \"" + normalizedOptionString + "\" is already defined" );
-		}
 
-		// Create the option handler
-		_OptionHandler handler;
-		handler.defaultStringValue = defaultValue;
-		if ( ( ArgumentParser::OptionValue::required == valueRequired )
-			or ( ArgumentParser::OptionValue::optional == valueRequired ) )
-		{
-			handler.valueName = valueName;
-			mOptionsValueNames.insert( valueName );
-		}
-		handler.callback = callback;
-		handler.valueRequired = valueRequired;
-		handler.selection = selection;
-		handler.helpString = helpString;
-		handler.requiredOption = required;
+				if ( variableName.empty() or ( std::string::npos != variableName.find( '=' ) ) )
+				{
+					throw std::invalid_argument( "The environment variable name \"" + variableName + "\" is not valid" );
+				}
 
-		// Add the option handler to the map
-		mOptionsHandlerMap[ normalizedOptionString ] = std::move( handler );
+				if ( schema.environmentBindings.end() != schema.environmentBindings.find( variableName ) )
+				{
+					throw std::invalid_argument( "The environment variable \"" + variableName + "\" is already bound to option: "
+						+ schema.environmentBindings[ variableName ] );
+				}
 
-		// If required, add the option to the required options map
-		if ( required )
-		{
-			mRequiredOptions[ normalizedOptionString ] = false;
-		}
+				schema.environmentBindings[ variableName ] = normalizedOptionString;
+			} );
 	}
 
 	/**
@@ -661,13 +4090,35 @@ public:
 	 */
 	void clear()
 	{
-		for ( const auto& requiredOption : mRequiredOptions )
-		{
-			mRequiredOptions[ requiredOption.first ] = false;
-		}
-
+		mSeenOptions.clear();
 		mParsedOptions.clear();
 		mNonOptionArguments.clear();
+		mNonOptionPathInformation.clear();
+		mCommandLineArguments.clear();
+		_publishParseResult();
+	}
+
+	/**
+	 * Get a value of a parsed option converted to {@tparam Type}, see {@see OptionArgument::get()}.
+	 * The option is looked up as with {@see hasParsedOption()}.
+	 * @param optionOrValueName Const reference to the option flag, or valueName of the option.
+	 * @param index Index of value to retrieve. [default: 0]
+	 * @return The converted value.
+	 * @throw std::out_of_range is thrown if the option has not been parsed, or no value exists at the given index.
+	 * @throw std::invalid_argument is thrown if a value cannot be converted.
+	 */
+	template < typename Type >
+	Type get(
+		const std::string& optionOrValueName,
+		size_t index = 0 ) const
+	{
+		std::shared_ptr< const _Schema > schema( _loadSchema() );
+		const _OptionHandler* handler = ( 0 == optionOrValueName.compare( 0, 2, "--" ) )
+			? _findHandler( *schema, optionOrValueName ) : nullptr;
+		const std::string& parsedKey = ( ( nullptr == handler ) or handler->valueName.empty() )
+			? optionOrValueName : handler->valueName;
+
+		return mParsedOptions.at( parsedKey ).get< Type >( index );
 	}
 
 	/**
@@ -692,6 +4143,29 @@ public:
 		return mNonOptionArguments;
 	}
 
+	/**
+	 * Get the immutable snapshot of the last published parse result.
+	 * A snapshot is published by {@see parseArguments()}, {@see reloadArguments()}, and {@see clear()}.
+	 * Unlike the references returned by {@see getParsedOptions()}, the snapshot remains valid while
+	 * the parser is cleared or parses again, and may be read by any number of threads without locking.
+	 * @return A shared pointer to the last published parse result, never null.
+	 */
+	std::shared_ptr< const ParseResult > getParseResult() const
+	{
+		return std::atomic_load( &mParseResult );
+	}
+
+	/**
+	 * Get the cached path information of the non-option arguments. This is only
+	 * populated when path validation is enabled for the non-option arguments,
+	 * see {@see setNonOptionPathValidation()}.
+	 * @return A const reference to the path information vector, indexed as the non-option arguments vector.
+	 */
+	const std::vector< OptionArgument::PathInformation >& getNonOptionPathInformation() const
+	{
+		return mNonOptionPathInformation;
+	}
+
 	/**
 	 * Check if an option flag has been parsed, or if an associated
 	 * valueName for an option flag is present in the parsed options map.
@@ -705,9 +4179,10 @@ public:
 	{
 		if ( 0 == strncmp( optionOrValueName.c_str(), "--", 2 ) )
 		{
-			auto mapIterator = mOptionsHandlerMap.find( optionOrValueName );
+			std::shared_ptr< const _Schema > schema( _loadSchema() );
+			auto mapIterator = schema->optionsHandlerMap.find( optionOrValueName );
 
-			if ( mOptionsHandlerMap.end() == mapIterator )
+			if ( schema->optionsHandlerMap.end() == mapIterator )
 			{
 				return false;
 			}
@@ -773,6 +4248,10 @@ public:
 	 *             That is, the element at argv[ argc ] is expected to be a null pointer.
 	 * @param throwOnMissingOptions Flag that an exception should be thrown
 	 *                              instead of calling exit(). [default: false]
+	 * @throw MissingRequiredOption is thrown if {@param throwOnMissingOptions} is set and required options are missing.
+	 * @throw OptionConstraintViolation is thrown if {@param throwOnMissingOptions} is set and the positional arguments,
+	 *                                  option groups, or constraints are violated.
+	 * @throw InvalidPathArguments is thrown if {@param throwOnMissingOptions} is set and any path validation fails.
 	 */
 	void parseArguments(
 		int argc,
@@ -784,146 +4263,456 @@ public:
 			throw std::invalid_argument( "The last argument must be NULL" );
 		}
 
-		bool helpOptionPresent = false;
-		std::vector< std::string > missingOptions;
+		_parseRange( argv, argv + argc, throwOnMissingOptions );
+	}
 
-		// Iterate over arguments
-		for ( int index( 0 ); ++index < argc; )
+	/**
+	 * Parse arguments from any range of string-like elements, such as a std::vector< std::string >,
+	 * an array of c-strings, or a range of string views, without building a null terminated c-string array.
+	 * The first element is the application name, as with {@see parseArguments( int, char const* const*, bool )},
+	 * which this otherwise behaves the same as.
+	 * @param arguments The range of arguments. Each element must be convertible to std::string.
+	 * @param throwOnMissingOptions Flag that an exception should be thrown
+	 *                              instead of calling exit(). [default: false]
+	 * @throw std::invalid_argument is thrown if an element is a null c-string.
+	 * @throw MissingRequiredOption is thrown if {@param throwOnMissingOptions} is set and required options are missing.
+	 * @throw OptionConstraintViolation is thrown if {@param throwOnMissingOptions} is set and the positional arguments,
+	 *                                  option groups, or constraints are violated.
+	 * @throw InvalidPathArguments is thrown if {@param throwOnMissingOptions} is set and any path validation fails.
+	 */
+	template < typename Range, typename = decltype( std::begin( std::declval< const Range& >() ) ) >
+	void parseArguments(
+		const Range& arguments,
+		bool throwOnMissingOptions = false )
+	{
+		_parseRange( std::begin( arguments ), std::end( arguments ), throwOnMissingOptions );
+	}
+
+	/**
+	 * Load a parse result in place of parsing arguments, for instance one deserialized from
+	 * a parent process with {@see ParseResult::deserialize()}. No callbacks are invoked,
+	 * and the parse result is published as is, see {@see getParseResult()}. Its canonical arguments,
+	 * see {@see ParseResult::canonicalArguments()}, take the place of the command line arguments for
+	 * {@see reloadArguments()}; options that stream their values are not retained, so they are lost on reload.
+	 * @param parseResult The parse result to load.
+	 * @throw std::invalid_argument is thrown if {@param parseResult} is null.
+	 */
+	void loadParseResult(
+		const std::shared_ptr< const ParseResult >& parseResult )
+	{
+		if ( nullptr == parseResult )
+		{
+			throw std::invalid_argument( "The parse result may not be null" );
+		}
+
+		mParsedOptions = parseResult->mParsedOptions;
+		mNonOptionArguments = parseResult->mNonOptionArguments;
+		mNonOptionPathInformation = parseResult->mNonOptionPathInformation;
+
+		// The canonical form of the parse result stands in for the command line, for reloadArguments()
+		std::vector< std::string > arguments( 1, mCommandLineArguments.empty() ? std::string() : mCommandLineArguments[ 0 ] );
+		parseResult->_visitCanonicalArguments( [ &arguments ]( const std::string& argument ) { arguments.push_back( argument ); } );
+		mCommandLineArguments = std::move( arguments );
+
+		mSeenOptions.clear();
+		for ( const auto& handlerIter : _loadSchema()->optionsHandlerMap )
 		{
-			if ( nullptr == argv[ index ] )
+			const _OptionHandler& handler = handlerIter.second;
+
+			if ( mParsedOptions.end() != mParsedOptions.find( handler.valueName.empty() ? handlerIter.first : handler.valueName ) )
 			{
-				goto clearAndThrowInvalidArgument;
+				_markSeen( handler.ordinal );
 			}
+		}
+
+		std::atomic_store( &mParseResult, parseResult );
+	}
+
+	/**
+	 * Parse arguments at runtime in a restricted mode, accepting only the option flags flagged as
+	 * runtime mutable, see {@see setRuntimeMutable()}. Each option flag present has its values replaced by
+	 * those given, selected according to its OptionSelection. The update is checked against the option groups,
+	 * constraints, and path validation as a parse is, and is applied entirely or not at all.
+	 * The new parse result is published, see {@see getParseResult()}, then the callbacks of the options
+	 * whose values changed are invoked. Runtime changes are not kept by {@see reloadArguments()}.
+	 * @param arguments The option flags and their values; there is no leading application name.
+	 * @return The keys, valueName or option flag, of the parsed options that changed.
+	 * @throw std::invalid_argument is thrown if an argument is not a runtime mutable option flag or its value,
+	 *                              or if a required value is not present.
+	 * @throw OptionConstraintViolation is thrown if the update would violate the option groups or constraints.
+	 * @throw InvalidPathArguments is thrown if any path validation of the updated options fails.
+	 */
+	std::vector< std::string > parseRuntimeArguments(
+		const std::vector< std::string >& arguments )
+	{
+		struct Update
+		{
+			const std::map< std::string, _OptionHandler >::value_type* option;
+			std::string optionValue;
+			size_t valuesBegin;
+			size_t valuesEnd;
+		};
 
-			std::string argument( argv[ index ] );
-			if ( 0 == strncmp( argv[ index ], "--", 2 ) )
+		std::shared_ptr< const _Schema > schema( _loadSchema() );
+		std::vector< Update > updates;
+		std::string negatedOption;
+		bool negated;
+
+		// Validate the entire update before applying any of it
+		for ( size_t index( 0 ); index < arguments.size(); ++index )
+		{
+			const std::string& argument = arguments[ index ];
+			auto mapIterator = _findOptionHandler( *schema, argument, negatedOption, negated );
+
+			if ( ( schema->optionsHandlerMap.end() == mapIterator ) or not mapIterator->second.runtimeMutable )
 			{
-				// Check for '--help' before anything else
-				if ( 0 == strcasecmp( "--help", argv[ index ] ) )
+				throw std::invalid_argument( "Not a runtime mutable option flag: " + argument );
+			}
+
+			const _OptionHandler& handler = mapIterator->second;
+			bool hasNext = ( index + 1 ) < arguments.size();
+			std::string optionValue( handler.defaultStringValue );
+
+			if ( 0 != handler.maximumValues )
+			{
+				size_t valueCount = _countGroupValues( handler, arguments, index );
+
+				if ( valueCount < handler.minimumValues )
 				{
-					_printHelp( argv[ 0 ] );
-					exit( EXIT_SUCCESS );
+					throw std::invalid_argument( "Required values not present for option: " + argument );
 				}
 
-				// Check if the option has a handler
-				auto mapIterator = mOptionsHandlerMap.find( argument );
-
-				if ( mOptionsHandlerMap.end() == mapIterator )
+				updates.push_back( { &*mapIterator, std::string(), index + 1, index + 1 + valueCount } );
+				index += valueCount;
+				continue;
+			}
+			else if ( ArgumentParser::OptionValue::optional == handler.valueRequired )
+			{
+				if ( hasNext and ( 0 != arguments[ index + 1 ].compare( 0, 2, "--" ) ) )
 				{
-					// Output an error message, then ignore
-					fprintf( stderr, "Unknown option flag: %s\n", argv[ index ] );
-					continue;
+					optionValue = arguments[ ++index ];
 				}
-				else
+			}
+			else if ( ArgumentParser::OptionValue::required == handler.valueRequired )
+			{
+				if ( not hasNext )
 				{
-					const _OptionHandler& handler = mapIterator->second;
-					std::string optionValue( handler.defaultStringValue );
+					throw std::invalid_argument( "Required value not present for option: " + argument );
+				}
 
-					// Get the value if applicable
-					if ( ArgumentParser::OptionValue::optional == handler.valueRequired )
-					{
-						if ( ( nullptr != argv[ index + 1 ] )
-							and ( 0 != strncmp( argv[ index + 1 ], "--", 2 ) ) )
-						{
-							optionValue.assign( argv[ ++index ] );
-						}
-					}
-					else if ( ArgumentParser::OptionValue::required == handler.valueRequired )
-					{
-						if ( nullptr == argv[ index + 1 ] )
-						{
-							fprintf( stderr, "Required value not present for option: %s\n", argument.c_str() );
-							continue;
-						}
+				optionValue = arguments[ ++index ];
+			}
+			else if ( ArgumentParser::OptionValue::negatable == handler.valueRequired )
+			{
+				optionValue = negated ? "false" : "true";
+			}
 
-						optionValue.assign( argv[ ++index ] );
-					}
+			updates.push_back( { &*mapIterator, std::move( optionValue ), 0, 0 } );
+		}
 
-					if ( ( ArgumentParser::OptionValue::optional == handler.valueRequired )
-						or ( ArgumentParser::OptionValue::required == handler.valueRequired ) )
-					{
-						// Check how to handle the value
-						// Regardless of which value is selected, if nothing is present we insert the first
-						if ( mParsedOptions.end() == mParsedOptions.find( handler.valueName ) )
-						{
-							mParsedOptions.insert(
-								{
-									handler.valueName,
-									OptionArgument( argument, handler.valueName,
-										std::vector< std::string > { optionValue } )
-								} );
-						}
-						else
-						{
-							// Take only the last value
-							if ( ArgumentParser::OptionSelection::take_last == handler.selection )
-							{
-								mParsedOptions[ handler.valueName ].mOptionValues[ 0 ] = optionValue;
-							}
-
-							// Push it to the vector, we're taking all the values
-							if ( ArgumentParser::OptionSelection::take_all == handler.selection )
-							{
-								mParsedOptions[ handler.valueName ].mOptionValues.push_back( optionValue );
-							}
-						}
-					}
-					else
-					{
-						mParsedOptions[ argument ] = OptionArgument( argument );
-					}
+		std::map< std::string, OptionArgument > previousOptions( mParsedOptions );
+		std::vector< uint64_t > previousSeenOptions( mSeenOptions );
 
-					// Check for a callback
-					if ( nullptr != handler.callback )
-					{
-						handler.callback( optionValue );
-					}
-				}
+		for ( const auto& update : updates )
+		{
+			const _OptionHandler& handler = update.option->second;
+			_eraseParsedOption( handler.valueName.empty() ? update.option->first : handler.valueName );
+		}
 
-				// Check if this is a required option flag
-				if ( mRequiredOptions.end() != mRequiredOptions.find( argument ) )
-				{
-					mRequiredOptions[ argument ] = true;
-				}
+		mDeferredStreamValues.clear();
+		mSuppressCallbacks = true;
+		for ( const auto& update : updates )
+		{
+			if ( 0 != update.option->second.maximumValues )
+			{
+				_applyOptionGroup( update.option->first, update.option->second,
+					arguments.data() + update.valuesBegin, arguments.data() + update.valuesEnd );
 			}
 			else
 			{
-				mNonOptionArguments.push_back( std::move( argument ) );
+				_applyOptionValue( update.option->first, update.option->second, update.optionValue );
 			}
 		}
+		mSuppressCallbacks = false;
+		mUniqueValues.clear();
 
-		// Check for missing required arguments
-		for ( const auto& requiredOption : mRequiredOptions )
+		// Check the option groups, constraints, and paths as a parse would, rejecting the update on any violation
+		std::vector< std::string > violations( _checkConstraints( *schema ) );
+		std::vector< std::string > invalidPaths;
+		if ( violations.empty() )
 		{
-			if ( not requiredOption.second )
-			{
-				missingOptions.push_back( requiredOption.first );
-			}
+			invalidPaths = _validatePaths( *schema );
 		}
 
-		// Throw if we have missing required arguments
-		if ( not missingOptions.empty() )
+		if ( not violations.empty() or not invalidPaths.empty() )
 		{
-			if ( throwOnMissingOptions )
+			mParsedOptions = std::move( previousOptions );
+			mSeenOptions = std::move( previousSeenOptions );
+
+			if ( not violations.empty() )
 			{
-				throw MissingRequiredOption( missingOptions );
+				throw OptionConstraintViolation( violations );
 			}
 
-			_printHelp( argv[ 0 ], missingOptions );
-			exit( EXIT_FAILURE );
+			throw InvalidPathArguments( invalidPaths );
 		}
 
-		return;
+		_publishParseResult();
+		return _dispatchChangedOptions( *schema, previousOptions );
+	}
+
+	/**
+	 * Reload the arguments, re-reading the configuration files and the environment, and re-parsing
+	 * the command line arguments of the last {@see parseArguments()} call, or those of the last {@see loadParseResult()} call.
+	 * The new parse result is published, see {@see getParseResult()}, before the callbacks are dispatched. The callbacks are only invoked
+	 * for the options whose values changed; options no longer present have their callback invoked with
+	 * their default value. Options that stream their values are changed when the digest of their streamed values differs,
+	 * see {@see ParseResult::fingerprint()}, and then have each of their values handed to their callback again.
+	 * Should the reload fail, the previously parsed options are restored and the exception is rethrown.
+	 * @return The keys, valueName or option flag, of the parsed options that changed.
+	 * @throw MissingRequiredOption is thrown if required options are missing.
+	 * @throw OptionConstraintViolation is thrown if the positional arguments, option groups, or constraints are violated.
+	 * @throw InvalidPathArguments is thrown if any path validation fails.
+	 */
+	std::vector< std::string > reloadArguments()
+	{
+		std::shared_ptr< const _Schema > schema( _loadSchema() );
+		std::map< std::string, OptionArgument > previousOptions( std::move( mParsedOptions ) );
+		std::vector< std::string > previousNonOptionArguments( std::move( mNonOptionArguments ) );
+		std::vector< OptionArgument::PathInformation > previousPathInformation( std::move( mNonOptionPathInformation ) );
+		std::vector< uint64_t > previousSeenOptions( std::move( mSeenOptions ) );
 
-	clearAndThrowInvalidArgument:
 		mParsedOptions.clear();
 		mNonOptionArguments.clear();
-		for ( const auto& requiredOption : mRequiredOptions )
+		mNonOptionPathInformation.clear();
+		mSeenOptions.clear();
+
+		mDeferredStreamValues.clear();
+
+		try
 		{
-			mRequiredOptions[ requiredOption.first ] = false;
+			mSuppressCallbacks = true;
+			_parseArguments( *schema, true );
+			mSuppressCallbacks = false;
 		}
+		catch ( ... )
+		{
+			mSuppressCallbacks = false;
+			mParsedOptions = std::move( previousOptions );
+			mNonOptionArguments = std::move( previousNonOptionArguments );
+			mNonOptionPathInformation = std::move( previousPathInformation );
+			mSeenOptions = std::move( previousSeenOptions );
+			throw;
+		}
+
+		_publishParseResult();
+		return _dispatchChangedOptions( *schema, previousOptions );
+	}
+
+	/**
+	 * Set the path validation of the non-option arguments.
+	 * When enabled, every non-option argument is checked after parsing, see {@see setPathValidation()}.
+	 * @param validation How the non-option arguments are to be validated. [default: PathValidation::readable]
+	 */
+	void setNonOptionPathValidation(
+		ArgumentParser::PathValidation validation = ArgumentParser::PathValidation::readable )
+	{
+		_changeSchema( [ & ]( _Schema& schema )
+			{
+				schema.nonOptionPathValidation = validation;
+			} );
+	}
+
+	/**
+	 * Flag an option as mutable at runtime, see {@see parseRuntimeArguments()}.
+	 * @param optionString The option flag, as given to {@see addOption()}.
+	 * @param runtimeMutable Whether the option may be changed at runtime. [default: true]
+	 * @throw std::invalid_argument is thrown if there is no handler defined for {@param optionString}.
+	 */
+	void setRuntimeMutable(
+		const std::string& optionString,
+		bool runtimeMutable = true )
+	{
+		_changeSchema( [ & ]( _Schema& schema )
+			{
+				std::string normalizedOptionString( _normalizeOptionString( optionString ) );
+				auto mapIterator = schema.optionsHandlerMap.find( normalizedOptionString );
+
+				if ( schema.optionsHandlerMap.end() == mapIterator )
+				{
+					throw std::invalid_argument( "The handler for option \"" + normalizedOptionString + "\" is not defined" );
+				}
+
+				mapIterator->second.runtimeMutable = runtimeMutable;
+			} );
+	}
+
+	/**
+	 * Set the path validation of an option's values.
+	 * When enabled, every value collected for the option is checked after parsing, in parallel
+	 * across threads, and every failure is reported together. The file type and size of each
+	 * path is cached and accessible with {@see OptionArgument::pathInformation()}.
+	 * @param optionString The option flag, as given to {@see addOption()}.
+	 * @param validation How the values of the option are to be validated. [default: PathValidation::readable]
+	 * @throw std::invalid_argument is thrown if there is no handler defined for {@param optionString}.
+	 * @throw std::invalid_argument is thrown if the option does not take a value.
+	 */
+	void setPathValidation(
+		const std::string& optionString,
+		ArgumentParser::PathValidation validation = ArgumentParser::PathValidation::readable )
+	{
+		_changeSchema( [ & ]( _Schema& schema )
+			{
+				std::string normalizedOptionString( _normalizeOptionString( optionString ) );
+				auto mapIterator = schema.optionsHandlerMap.find( normalizedOptionString );
+
+				if ( schema.optionsHandlerMap.end() == mapIterator )
+				{
+					throw std::invalid_argument( "The handler for option \"" + normalizedOptionString + "\" is not defined" );
+				}
+
+				if ( mapIterator->second.valueName.empty() )
+				{
+					throw std::invalid_argument( "The option \"" + normalizedOptionString + "\" does not take a value" );
+				}
+
+				mapIterator->second.pathValidation = validation;
+			} );
+	}
+
+	/**
+	 * Make an option a flag-set option with a fixed vocabulary of up to 64 names.
+	 * Each value of the option is a comma separated list of names, such as "simd,prefetch,-numa,+hugepages",
+	 * decoded while parsing into the bitmask returned by {@see OptionArgument::flags()}, where bit N is the Nth name.
+	 * Names prefixed with '-' clear their bit, those prefixed with '+', or not prefixed, set it.
+	 * With OptionSelection::take_all or OptionSelection::stream, every occurrence is applied to the bitmask in order,
+	 * with OptionSelection::take_last only the last, and with OptionSelection::take_first only the first.
+	 * Names not in the vocabulary are reported and ignored. The values themselves are kept as for any other option.
+	 * @param optionString The option flag, as given to {@see addOption()}.
+	 * @param vocabulary The names of the flags, in bit order.
+	 * @throw std::invalid_argument is thrown if there is no handler defined for {@param optionString}.
+	 * @throw std::invalid_argument is thrown if the option does not take a value, or takes a number of values.
+	 * @throw std::invalid_argument is thrown if {@param vocabulary} is empty, has more than 64 names, or has a name
+	 *                              that is empty, repeated, prefixed with '+' or '-', or contains a ','.
+	 */
+	void setFlagSetVocabulary(
+		const std::string& optionString,
+		const std::vector< std::string >& vocabulary )
+	{
+		_changeSchema( [ & ]( _Schema& schema )
+			{
+				std::string normalizedOptionString( _normalizeOptionString( optionString ) );
+				auto mapIterator = schema.optionsHandlerMap.find( normalizedOptionString );
+
+				if ( schema.optionsHandlerMap.end() == mapIterator )
+				{
+					throw std::invalid_argument( "The handler for option \"" + normalizedOptionString + "\" is not defined" );
+				}
+
+				if ( mapIterator->second.valueName.empty() )
+				{
+					throw std::invalid_argument( "The option \"" + normalizedOptionString + "\" does not take a value" );
+				}
+
+				if ( vocabulary.empty() or ( 64 < vocabulary.size() ) )
+				{
+					throw std::invalid_argument( "The vocabulary of option \"" + normalizedOptionString + "\" must have between 1 and 64 names" );
+				}
+
+				std::set< std::string > names;
+				for ( const auto& name : vocabulary )
+				{
+					if ( name.empty() or ( '+' == name[ 0 ] ) or ( '-' == name[ 0 ] ) or ( std::string::npos != name.find( ',' ) ) )
+					{
+						throw std::invalid_argument( "Invalid flag name \"" + name + "\" for option: " + normalizedOptionString );
+					}
+
+					if ( not names.insert( name ).second )
+					{
+						throw std::invalid_argument( "The flag name \"" + name + "\" is repeated for option: " + normalizedOptionString );
+					}
+				}
+
+				if ( 0 != mapIterator->second.maximumValues )
+				{
+					throw std::invalid_argument( "The option \"" + normalizedOptionString + "\" takes a number of values" );
+				}
+
+				mapIterator->second.flagSet = std::make_shared< const _FlagSet >( vocabulary );
+			} );
+	}
+
+	/**
+	 * Set the number of values taken by each occurrence of an option, like the nargs of other argument parsers:
+	 * N values with ( N, N ), "?" with ( 0, 1 ), "*" with ( 0, UNLIMITED_VALUES ), and "+" with ( 1, UNLIMITED_VALUES ).
+	 * The values following the option flag are taken, up to {@param maximum} and until the next option flag,
+	 * and stored together as a group, see {@see OptionArgument::group()}. The values of all groups are also accessible
+	 * in order with {@see OptionArgument::value()}. OptionSelection::take_first and OptionSelection::take_last retain
+	 * a single group, OptionSelection::take_all retains every group. The {@param callback} given to {@see addOption()}
+	 * is handed each value. In the configuration files and the environment, the values are separated by whitespace.
+	 * @param optionString The option flag, as given to {@see addOption()}.
+	 * @param minimum The least number of values to be given with the option flag.
+	 * @param maximum The most number of values to be taken with the option flag.
+	 * @throw std::invalid_argument is thrown if there is no handler defined for {@param optionString}.
+	 * @throw std::invalid_argument is thrown if the option does not take a value, or is a flag-set option.
+	 * @throw std::invalid_argument is thrown if the option selects OptionSelection::take_unique.
+	 * @throw std::invalid_argument is thrown if {@param maximum} is 0, or less than {@param minimum}.
+	 */
+	void setOptionValueCount(
+		const std::string& optionString,
+		size_t minimum,
+		size_t maximum )
+	{
+		_changeSchema( [ & ]( _Schema& schema )
+			{
+				std::string normalizedOptionString( _normalizeOptionString( optionString ) );
+				auto mapIterator = schema.optionsHandlerMap.find( normalizedOptionString );
+
+				if ( schema.optionsHandlerMap.end() == mapIterator )
+				{
+					throw std::invalid_argument( "The handler for option \"" + normalizedOptionString + "\" is not defined" );
+				}
+
+				_OptionHandler& handler = mapIterator->second;
+
+				if ( handler.valueName.empty() )
+				{
+					throw std::invalid_argument( "The option \"" + normalizedOptionString + "\" does not take a value" );
+				}
 
-		throw std::invalid_argument( "Null pointer found in the middle of the arguments list." );
+				if ( nullptr != handler.flagSet )
+				{
+					throw std::invalid_argument( "The option \"" + normalizedOptionString + "\" is a flag-set option" );
+				}
+
+				if ( ArgumentParser::OptionSelection::take_unique == handler.selection )
+				{
+					throw std::invalid_argument( "The option \"" + normalizedOptionString + "\" may not select unique values" );
+				}
+
+				if ( ( 0 == maximum ) or ( maximum < minimum ) )
+				{
+					throw std::invalid_argument( "Invalid number of values for option: " + normalizedOptionString );
+				}
+
+				handler.minimumValues = minimum;
+				handler.maximumValues = maximum;
+			} );
+	}
+
+	/**
+	 * Set whether unknown option flags on the command line are skipped silently, rather than reported.
+	 * This is for parsers that only read their own options out of a command line shared with other parsers.
+	 * A value following an unknown option flag is taken as a non-option argument.
+	 * @param ignoreUnknownOptions Whether to skip unknown option flags silently. [default: true]
+	 */
+	void setIgnoreUnknownOptions(
+		bool ignoreUnknownOptions = true )
+	{
+		_changeSchema( [ & ]( _Schema& schema )
+			{
+				schema.ignoreUnknownOptions = ignoreUnknownOptions;
+			} );
 	}
 
 	/**
@@ -933,6 +4722,9 @@ public:
 	void setApplicationDescription(
 		const std::string& applicationDescription )
 	{
-		mApplicationDescription = applicationDescription;
+		_changeSchema( [ & ]( _Schema& schema )
+			{
+				schema.applicationDescription = applicationDescription;
+			} );
 	}
 };
@@ -0,0 +1,314 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+// Standard includes
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Local includes
+#include "ArgumentParser.hpp"
+
+/*
+ * Notes:
+ *   - The command line is read from /proc/self/cmdline, which is only available on Linux;
+ *     elsewhere the global parser sees an empty command line
+ *   - Link with -pthread where required
+ */
+
+/**
+ * This class is responsible for a process wide ArgumentParser, for library code that needs its own
+ * option flags without having argc and argv threaded through to it. The options are added by registrars,
+ * static instances of {@see GlobalArgumentParser::Registrar} defined in any translation unit. Nothing is
+ * parsed until the first query: the options of all registrars are added as one change, and the command
+ * line of the process is read once and parsed, with thread-safe one-time initialization. Unknown option flags,
+ * those of the application's own parser, are skipped silently, and "--help" is left to the application.
+ * Registrars constructed after the first query, such as those of plugins loaded with dlopen(), have their
+ * options merged in, and the command line is parsed again, see {@see ArgumentParser::reloadArguments()}.
+ *
+ * Example:
+ *     static const ArgumentParser::OptionDescriptor LOG_OPTIONS[] = {
+ *         { "log-level", "LOG_LEVEL", false, "The level to log at", ArgumentParser::OptionValue::required,
+ *           ArgumentParser::OptionSelection::take_last, nullptr, "info" } };
+ *
+ *     static GlobalArgumentParser::Registrar logOptionsRegistrar( LOG_OPTIONS );
+ *
+ *     int logLevel = GlobalArgumentParser::get< int >( "LOG_LEVEL" );
+ */
+class GlobalArgumentParser
+{
+public:
+
+	/**
+	 * A registration of options with the global parser. Registrars are linked into an intrusive list when
+	 * constructed, without allocating, so they may be defined as static instances in any translation unit.
+	 * The options are only read on the first query of the global parser, so the order of static initialization
+	 * across translation units does not matter. Registrars are never unlinked, and must outlive the process,
+	 * or the plugin holding them must not be unloaded.
+	 */
+	class Registrar
+	{
+	private:
+
+		friend class GlobalArgumentParser;
+
+		void ( *mAddOptions )( ArgumentParser& parser );
+		const ArgumentParser::OptionDescriptor* mDescriptorsBegin;
+		const ArgumentParser::OptionDescriptor* mDescriptorsEnd;
+		Registrar* mNext;
+
+	public:
+
+		/**
+		 * Register a function adding options to the global parser.
+		 * @param addOptions The function adding the options, called once before the options are parsed.
+		 */
+		explicit Registrar(
+			void ( *addOptions )( ArgumentParser& parser ) ) :
+			mAddOptions( addOptions ),
+			mDescriptorsBegin( nullptr ),
+			mDescriptorsEnd( nullptr ),
+			mNext( nullptr )
+		{
+			_register( this );
+		}
+
+		/**
+		 * Register an array of option descriptors with the global parser, see {@see ArgumentParser::addOptions()}.
+		 * @param begin Pointer to the first descriptor. The descriptors must outlive the registrar.
+		 * @param end Pointer past the last descriptor.
+		 */
+		Registrar(
+			const ArgumentParser::OptionDescriptor* begin,
+			const ArgumentParser::OptionDescriptor* end ) :
+			mAddOptions( nullptr ),
+			mDescriptorsBegin( begin ),
+			mDescriptorsEnd( end ),
+			mNext( nullptr )
+		{
+			_register( this );
+		}
+
+		/**
+		 * Register an array of option descriptors with the global parser, see {@see ArgumentParser::addOptions()}.
+		 * @param descriptors The array of descriptors. The descriptors must outlive the registrar.
+		 */
+		template < size_t Count >
+		explicit Registrar(
+			const ArgumentParser::OptionDescriptor ( &descriptors )[ Count ] ) :
+			Registrar( descriptors, descriptors + Count )
+		{
+		}
+
+		Registrar(
+			const Registrar& other ) = delete;
+
+		Registrar& operator=(
+			const Registrar& other ) = delete;
+	};
+
+private:
+
+	// The head of the intrusive list of registrars, constant initialized
+	static Registrar*& _registrars()
+	{
+		static Registrar* registrars = nullptr;
+		return registrars;
+	}
+
+	// Set once the command line has been parsed, guarded by the registration mutex
+	static bool& _initialized()
+	{
+		static bool initialized = false;
+		return initialized;
+	}
+
+	// Guards the list of registrars and the merging of options into the global parser
+	static std::mutex& _registrationMutex()
+	{
+		static std::mutex registrationMutex;
+		return registrationMutex;
+	}
+
+	// The global parser, constructed on first use
+	static ArgumentParser& _parser()
+	{
+		static ArgumentParser parser;
+		return parser;
+	}
+
+	// Add the options of the registrars, the descriptors of all of them in one call
+	static void _addOptions(
+		ArgumentParser& parser,
+		Registrar* registrars )
+	{
+		std::vector< ArgumentParser::OptionDescriptor > descriptors;
+
+		for ( Registrar* registrar = registrars; nullptr != registrar; registrar = registrar->mNext )
+		{
+			descriptors.insert( descriptors.end(), registrar->mDescriptorsBegin, registrar->mDescriptorsEnd );
+		}
+
+		parser.addOptions( descriptors.data(), descriptors.data() + descriptors.size() );
+
+		for ( Registrar* registrar = registrars; nullptr != registrar; registrar = registrar->mNext )
+		{
+			if ( nullptr != registrar->mAddOptions )
+			{
+				registrar->mAddOptions( parser );
+			}
+		}
+	}
+
+	// Link the registrar, merging its options in should the command line have been parsed already
+	static void _register(
+		Registrar* registrar )
+	{
+		std::lock_guard< std::mutex > lock( _registrationMutex() );
+		registrar->mNext = _registrars();
+		_registrars() = registrar;
+
+		if ( not _initialized() )
+		{
+			return;
+		}
+
+		// Only the new registrar is merged, the remainder of the list has been added already
+		Registrar* next = registrar->mNext;
+		registrar->mNext = nullptr;
+
+		try
+		{
+			_addOptions( _parser(), registrar );
+			_parser().reloadArguments();
+		}
+		catch ( const std::exception& exception )
+		{
+			fprintf( stderr, "Unable to merge registered options: %s\n", exception.what() );
+		}
+
+		registrar->mNext = next;
+	}
+
+	// Add the registered options and parse the command line of the process. Library code must never end the process,
+	// nor may an exception escape std::call_once, which would have every later query initialize again. Should the
+	// registered options conflict, the error is reported and the options added so far are parsed; should the command
+	// line not satisfy the registered options, the error is reported and no options are parsed.
+	static void _initialize()
+	{
+		std::lock_guard< std::mutex > lock( _registrationMutex() );
+		ArgumentParser& parser = _parser();
+		parser.setIgnoreUnknownOptions();
+
+		try
+		{
+			_addOptions( parser, _registrars() );
+		}
+		catch ( const std::exception& exception )
+		{
+			fprintf( stderr, "Unable to add the registered options: %s\n", exception.what() );
+		}
+
+		std::vector< std::string > arguments( readCommandLine() );
+		arguments.erase( std::remove_if( arguments.begin(), arguments.end(),
+			[]( const std::string& argument ) { return 0 == strcasecmp( "--help", argument.c_str() ); } ), arguments.end() );
+
+		try
+		{
+			parser.parseArguments( arguments, true );
+		}
+		catch ( const std::exception& exception )
+		{
+			fprintf( stderr, "Unable to parse the registered options: %s\n", exception.what() );
+		}
+
+		_initialized() = true;
+	}
+
+public:
+
+	GlobalArgumentParser() = delete;
+
+	/**
+	 * Get the global parser, parsing the command line of the process on the first call.
+	 * Should the command line not satisfy the registered options, such as a required option that is missing,
+	 * the error is printed to stderr, rather than exiting, and the parse result is left empty. Should the registered
+	 * options conflict, such as two modules registering the same option flag, the error is printed to stderr and
+	 * the options added before the conflict are parsed. Either way the command line is parsed only once.
+	 * Options merged in from registrars constructed later have the command line parsed again in place, so while
+	 * plugins may be loading, read the parsed options through {@see ArgumentParser::getParseResult()}, as
+	 * {@see get()} and {@see hasParsedOption()} do.
+	 * @return Const reference to the global parser.
+	 */
+	static const ArgumentParser& parser()
+	{
+		static std::once_flag initialized;
+		std::call_once( initialized, &GlobalArgumentParser::_initialize );
+		return _parser();
+	}
+
+	/**
+	 * Get a value of a parsed option of the global parser, from its last published parse result, see {@see ParseResult::get()}.
+	 * Option flags that have an associated valueName must be looked up by their valueName.
+	 * @param optionOrValueName Const reference to the option flag, or valueName of the option.
+	 * @param index Index of value to retrieve. [default: 0]
+	 * @return The converted value.
+	 * @throw std::out_of_range is thrown if the option has not been parsed, or no value exists at the given index.
+	 * @throw std::invalid_argument is thrown if a value cannot be converted.
+	 */
+	template < typename Type >
+	static Type get(
+		const std::string& optionOrValueName,
+		size_t index = 0 )
+	{
+		return parser().getParseResult()->get< Type >( optionOrValueName, index );
+	}
+
+	/**
+	 * Check if an option has been parsed by the global parser, from its last published parse result, see {@see ParseResult::hasParsedOption()}.
+	 * Option flags that have an associated valueName must be looked up by their valueName.
+	 * @param optionOrValueName Const reference to the option flag, or valueName to check for.
+	 * @return True is returned if the option flag has been parsed, or if the valueName is present.
+	 */
+	static bool hasParsedOption(
+		const std::string& optionOrValueName )
+	{
+		return parser().getParseResult()->hasParsedOption( optionOrValueName );
+	}
+
+	/**
+	 * Read the command line of the process from /proc/self/cmdline.
+	 * @return The arguments of the command line, starting with the application name; empty if it cannot be read.
+	 */
+	static std::vector< std::string > readCommandLine()
+	{
+		std::vector< std::string > arguments;
+		FILE* file = fopen( "/proc/self/cmdline", "rb" );
+
+		if ( nullptr == file )
+		{
+			return arguments;
+		}
+
+		std::string contents;
+		char buffer[ 4096 ];
+		for ( size_t count; 0 < ( count = fread( buffer, 1, sizeof( buffer ), file ) ); contents.append( buffer, count ) );
+		fclose( file );
+
+		// Each argument is terminated by a null character
+		for ( size_t begin( 0 ), end; begin < contents.size(); begin = end + 1 )
+		{
+			end = contents.find( '\0', begin );
+			end = ( std::string::npos == end ) ? contents.size() : end;
+			arguments.emplace_back( contents, begin, end - begin );
+		}
+
+		return arguments;
+	}
+};